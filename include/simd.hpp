@@ -27,10 +27,13 @@
 #include <complex>              // std::complex
 #include <cstddef>              // std::size_t
 #include <cstdint>              // std::{u}int{8,16,32,64}_t
+#include <cstdio>               // std::fputs
+#include <cstdlib>              // std::abort
 #include <cstring>              // std::memcpy
 #include <functional>           // std::hash
 #include <initializer_list>     // std::initializer_list
 #include <iterator>             // std::iterator, std::reverse_iterator
+#include <limits>               // std::numeric_limits
 #include <memory>               // std::align, std::addressof
 #include <mutex>                // std::lock_guard, std::mutex
 #include <new>                  // std::{get,set}_new_handler
@@ -71,6 +74,60 @@
     #define cpp17_constexpr
 #endif
 
+/*
+ * The wrapper functions in namespace math, as well as transform itself, are
+ * thin shims over a handful of lane accesses; should any of them fail to
+ * inline, every SIMD vector argument (up to 64 bytes each) is spilled to
+ * the stack across the call. Both supported compilers honor the
+ * always_inline attribute, so force the issue.
+ */
+#define simd_always_inline inline __attribute__ ((always_inline))
+
+/*
+ * Branch weight hint for conditions that are almost never taken (error and
+ * overflow handling on otherwise straight-line paths). Both supported
+ * compilers provide __builtin_expect; the C++20 [[likely]] attributes are
+ * out of reach at this language level.
+ */
+#define simd_unlikely(condition) __builtin_expect (!!(condition), 0)
+
+/*
+ * Whether the compiler provides the generic non-temporal memory access
+ * builtins (Clang); the streaming load/store helpers degrade to ordinary
+ * aligned accesses without them.
+ */
+#if defined (__has_builtin)
+    #if __has_builtin (__builtin_nontemporal_store)
+        #define simd_has_nontemporal true
+    #else
+        #define simd_has_nontemporal false
+    #endif
+#else
+    #define simd_has_nontemporal false
+#endif
+
+/*
+ * Annotation for user kernels that should ship one binary covering several
+ * x86 microarchitecture levels: expands to the target_clones attribute, so
+ * the compiler emits a default, an AVX2 and an AVX-512 body for the
+ * function and installs an ifunc resolver that picks one at load time.
+ * Apply it to non-template, non-inline functions whose loops the compiler
+ * auto-vectorizes (for example batch_transform call sites); the fixed
+ * width SIMD types themselves keep the width they were declared with, the
+ * cloning widens the generated loop code. Expands to nothing where the
+ * attribute or the ELF ifunc mechanism is unavailable.
+ */
+#if defined (__has_attribute) && defined (__ELF__) && \
+    (defined (__x86_64__) || defined (__i386__))
+    #if __has_attribute (target_clones)
+        #define simd_multiversion \
+            __attribute__ ((target_clones ("default,avx2,avx512f")))
+    #endif
+#endif
+#if !defined (simd_multiversion)
+    #define simd_multiversion
+#endif
+
 /* -- Implementation Notes --
  *  Vector type specializations:
  *
@@ -117,6 +174,34 @@
  *  `-msse3`, `-mssse3`, `-msse4`, `-msse4.{1,2}`, `-mavx`, `-mavx2`,
  *  `-mavx512{f,bw,cd,dq,er,fma,pf,vbmi,vl}`, `-mneon`.
  *
+ *  On runtime CPU dispatch: the instruction set used for each vector type is
+ *  fixed at compile time by the flags above. Attribute based multi-versioning
+ *  (`target_clones`, manual `ifunc` resolvers) cannot be applied here because
+ *  neither GCC nor Clang supports cloning function templates, and every entry
+ *  point in this header is a template. Users shipping one binary for a range
+ *  of microarchitectures should instead compile the translation units using
+ *  this header once per target (e.g. `-mavx2`, `-mavx512f`) and select
+ *  between them at startup with `__builtin_cpu_supports`; the header is
+ *  self-contained and safe to include under several target settings within
+ *  one program provided the resulting symbols are kept in separate
+ *  translation units. The `simd::preferred_vector_bytes` helper performs
+ *  that startup query portably and reports the widest hardware backed
+ *  vector width of the executing processor.
+ *
+ *  Complex vector layout:
+ *
+ *  Complex SIMD types store their lanes as a structure of arrays: one vector
+ *  of real parts and one vector of imaginary parts, rather than the
+ *  interleaved re/im pairs of an array of `std::complex`. With the split
+ *  representation every arithmetic operation is expressed directly on whole
+ *  vectors (see the complex `operator*` and `operator/`, which are plain
+ *  multiplies, adds, and subtracts), where an interleaved layout would need a
+ *  lane shuffle on every operand of every operation. Interleaving only ever
+ *  happens at the memory boundary: the `load`/`load_aligned` overloads taking
+ *  a `std::complex` pointer de-interleave once on entry, the overloads taking
+ *  separate real and imaginary addresses avoid the conversion entirely, and
+ *  iteration materializes `std::complex` values lazily through proxies.
+ *
  *  Vector comparisons generated by GCC vs. those generated by Clang:
  *
  *  GCC vector comparison operations return vector types with lane type equal to
@@ -146,6 +231,17 @@
  *  are either `0` or `1`. Incorrect behavior will occur if this precondition is
  *  broken.
  *
+ *  Boolean vectors are deliberately full-width lane vectors rather than the
+ *  compact one-bit-per-lane predicates of AVX-512 `k` registers or SVE
+ *  predicate registers: the vector extensions provide no portable compact
+ *  mask type, and a full-width representation composes with blends and
+ *  arithmetic on every target. Code that needs the compact form at an
+ *  interoperation boundary (hardware gather/scatter masks, serialized
+ *  predicates) should convert explicitly through the boolean member
+ *  functions `bitmask` and `from_bitmask`, which pack to and unpack from
+ *  one bit per lane; the compilers lower full-width boolean operations onto
+ *  mask registers on targets where that is profitable.
+ *
  *  General discussion of comparison methods:
  *
  *  For all SIMD types we have overloads of `operator==`, and `operator!=`. For
@@ -158,6 +254,28 @@
  *  general and robust floating point comparisons can be easily implemented on
  *  top of the primitive operations provided therein.
  *
+ *  Carry-less (GF(2) polynomial) multiplication lane types are not provided.
+ *  The compilers expose carry-less multiplication only through technology
+ *  intrinsics (PCLMULQDQ/VPCLMULQDQ on x86, PMULL on ARM); there is no
+ *  generic builtin and no vector-extension operator that lowers to those
+ *  instructions, so a gf2-tagged SIMD type could not be implemented within
+ *  this header's portability contract -- a portable shift-and-xor fallback
+ *  would be orders of magnitude slower than both the hardware instruction
+ *  and the table-driven scalar codes it would replace, which is the
+ *  opposite of what a CRC or GHASH kernel wants. Kernels needing carry-less
+ *  folds should use the target intrinsics directly; the .data () method
+ *  hands the underlying vector to intrinsic calls and back without copies.
+ *
+ *  Half precision (binary16/bfloat16) lane types are not provided. The lane
+ *  type machinery leans on std::is_floating_point, std::numeric_limits,
+ *  std::hash and the <cmath> overload sets, and none of these cover the
+ *  compiler-extension types _Float16 and __bf16 under the C++11 language
+ *  baseline this header targets; __bf16 further lacks arithmetic entirely
+ *  in the supported GCC releases. Revisit once the standard fixed-width
+ *  floating point types (std::float16_t, std::bfloat16_t) are adoptable,
+ *  at which point they slot into the existing specialization macros like
+ *  any other lane type.
+ *
  *  `namespace simd` implementations of `namespace std` mathematical functions:
  *  We provide lane-by-lane overloads for the mathematical methods in the
  *  standard headers `<cstdlib>` and `<cmath>`. Planned extensions include
@@ -184,6 +302,23 @@ namespace simd
 {
 namespace detail
 {
+#if defined (__SIZEOF_INT128__)
+/*
+ * Compiler specific spellings of the 128 bit integral lane types: Clang
+ * ships the __int128_t/__uint128_t typedefs while GCC spells the types
+ * __int128 and unsigned __int128. Alias them once so every 128 bit lane
+ * site below names detail::i128/detail::u128 instead of repeating the
+ * preprocessor branch.
+ */
+#if SIMD_HEADER_CLANG
+    using i128 = __int128_t;
+    using u128 = __uint128_t;
+#elif SIMD_HEADER_GNUG
+    using i128 = __int128;
+    using u128 = unsigned __int128;
+#endif
+#endif   // defined (__SIZEOF_INT128__)
+
 namespace util
 {
 #if __cplusplus >= 201402L
@@ -339,15 +474,12 @@ namespace util
         return sd;
     }
 
+#if defined (__SIZEOF_INT128__)
     /*
      * Hash combine for specialization of std::hash for SIMD vector types.
      */
     template <>
-#if SIMD_HEADER_CLANG
-    inline void hash_combine (std::size_t & seed, __int128_t const & t) noexcept
-#elif SIMD_HEADER_GNUG
-    inline void hash_combine (std::size_t & seed, __int128 const & t) noexcept
-#endif
+    inline void hash_combine (std::size_t & seed, i128 const & t) noexcept
     {
         struct alias {
             std::int64_t a;
@@ -366,13 +498,8 @@ namespace util
      * vector types.
      */
     template <>
-#if SIMD_HEADER_CLANG
-    inline std::size_t hash_combine (std::size_t const & seed, __int128_t const & t)
-        noexcept
-#elif SIMD_HEADER_GNUG
-    inline std::size_t hash_combine (std::size_t const & seed, __int128 const & t)
+    inline std::size_t hash_combine (std::size_t const & seed, i128 const & t)
         noexcept
-#endif
     {
         struct alias {
             std::int64_t a;
@@ -392,11 +519,7 @@ namespace util
      * Hash combine for specialization of std::hash for SIMD vector types.
      */
     template <>
-#if SIMD_HEADER_CLANG
-    inline void hash_combine (std::size_t & seed, __uint128_t const & t) noexcept
-#elif SIMD_HEADER_GNUG
-    inline void hash_combine (std::size_t & seed, unsigned __int128 const & t) noexcept
-#endif
+    inline void hash_combine (std::size_t & seed, u128 const & t) noexcept
     {
         struct alias {
             std::uint64_t a;
@@ -415,13 +538,8 @@ namespace util
      * vector types.
      */
     template <>
-#if SIMD_HEADER_CLANG
-    inline std::size_t hash_combine (std::size_t const & seed, __uint128_t const & t)
+    inline std::size_t hash_combine (std::size_t const & seed, u128 const & t)
         noexcept
-#elif SIMD_HEADER_GNUG
-    inline std::size_t hash_combine (std::size_t const & seed,
-                                     unsigned __int128 const & t) noexcept
-#endif
     {
         struct alias {
             std::uint64_t a;
@@ -436,6 +554,7 @@ namespace util
         sd ^= hfn (a.b) + 0x9e3779b9 + (sd << 6) + (sd >> 2);
         return sd;
     }
+#endif   // defined (__SIZEOF_INT128__)
 }   // namespace util
 
 namespace vext
@@ -562,331 +681,25 @@ struct vector_type_specialization <ty, lanes>\
     specialize(long double, 32)
     specialize(long double, 64)
 
-#undef specialize
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __int128_t,
-#elif SIMD_HEADER_GNUG
-        __int128,
-#endif
-        1
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __int128_t type
-            __attribute__ ((vsize (1, sizeof (__int128_t))));
-        static constexpr std::size_t alignment = 1 * alignof (__int128_t);
-        static constexpr std::size_t size      = 1 * sizeof (__int128_t);
-#elif SIMD_HEADER_GNUG
-        typedef __int128 type __attribute__ ((vsize (1, sizeof (__int128))));
-        static constexpr std::size_t alignment = 1 * alignof (__int128);
-        static constexpr std::size_t size      = 1 * sizeof (__int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __int128_t,
-#elif SIMD_HEADER_GNUG
-        __int128,
-#endif
-        2
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __int128_t type
-            __attribute__ ((vsize (2, sizeof (__int128_t))));
-        static constexpr std::size_t alignment = 2 * alignof (__int128_t);
-        static constexpr std::size_t size      = 2 * sizeof (__int128_t);
-#elif SIMD_HEADER_GNUG
-        typedef __int128 type __attribute__ ((vsize (2, sizeof (__int128))));
-        static constexpr std::size_t alignment = 2 * alignof (__int128);
-        static constexpr std::size_t size      = 2 * sizeof (__int128);
-#endif
-    };
-
-template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __int128_t,
-#elif SIMD_HEADER_GNUG
-        __int128,
-#endif
-        4
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __int128_t type
-            __attribute__ ((vsize (4, sizeof (__int128_t))));
-        static constexpr std::size_t alignment = 4 * alignof (__int128_t);
-        static constexpr std::size_t size      = 4 * sizeof (__int128_t);
-#elif SIMD_HEADER_GNUG
-        typedef __int128 type __attribute__ ((vsize (4, sizeof (__int128))));
-        static constexpr std::size_t alignment = 4 * alignof (__int128);
-        static constexpr std::size_t size      = 4 * sizeof (__int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __int128_t,
-#elif SIMD_HEADER_GNUG
-        __int128,
-#endif
-        8
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __int128_t type
-            __attribute__ ((vsize (8, sizeof (__int128_t))));
-        static constexpr std::size_t alignment = 8 * alignof (__int128_t);
-        static constexpr std::size_t size      = 8 * sizeof (__int128_t);
-#elif SIMD_HEADER_GNUG
-        typedef __int128 type __attribute__ ((vsize (8, sizeof (__int128))));
-        static constexpr std::size_t alignment = 8 * alignof (__int128);
-        static constexpr std::size_t size      = 8 * sizeof (__int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __int128_t,
-#elif SIMD_HEADER_GNUG
-        __int128,
-#endif
-        16
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __int128_t type
-            __attribute__ ((vsize (16, sizeof (__int128_t))));
-        static constexpr std::size_t alignment = 16 * alignof (__int128_t);
-        static constexpr std::size_t size      = 16 * sizeof (__int128_t);
-#elif SIMD_HEADER_GNUG
-        typedef __int128 type __attribute__ ((vsize (16, sizeof (__int128))));
-        static constexpr std::size_t alignment = 16 * alignof (__int128);
-        static constexpr std::size_t size      = 16 * sizeof (__int128);
-#endif
-    };
-
-template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __int128_t,
-#elif SIMD_HEADER_GNUG
-        __int128,
-#endif
-        32
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __int128_t type
-            __attribute__ ((vsize (32, sizeof (__int128_t))));
-        static constexpr std::size_t alignment = 32 * alignof (__int128_t);
-        static constexpr std::size_t size      = 32 * sizeof (__int128_t);
-#elif SIMD_HEADER_GNUG
-        typedef __int128 type __attribute__ ((vsize (32, sizeof (__int128))));
-        static constexpr std::size_t alignment = 32 * alignof (__int128);
-        static constexpr std::size_t size      = 32 * sizeof (__int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __int128_t,
-#elif SIMD_HEADER_GNUG
-        __int128,
-#endif
-        64
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __int128_t type
-            __attribute__ ((vsize (64, sizeof (__int128_t))));
-        static constexpr std::size_t alignment = 64 * alignof (__int128_t);
-        static constexpr std::size_t size      = 64 * sizeof (__int128_t);
-#elif SIMD_HEADER_GNUG
-        typedef __int128 type __attribute__ ((vsize (64, sizeof (__int128))));
-        static constexpr std::size_t alignment = 64 * alignof (__int128);
-        static constexpr std::size_t size      = 64 * sizeof (__int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __uint128_t,
-#elif SIMD_HEADER_GNUG
-        unsigned __int128,
-#endif
-        1
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __uint128_t type
-            __attribute__ ((vsize (1, sizeof (__uint128_t))));
-        static constexpr std::size_t alignment = 1 * alignof (__uint128_t);
-        static constexpr std::size_t size      = 1 * sizeof (__uint128_t);
-#elif SIMD_HEADER_GNUG
-        typedef unsigned __int128 type
-            __attribute__ ((vsize (1, sizeof (unsigned __int128))));
-        static constexpr std::size_t alignment
-            = 1 * alignof (unsigned __int128);
-        static constexpr std::size_t size = 1 * sizeof (unsigned __int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __uint128_t,
-#elif SIMD_HEADER_GNUG
-        unsigned __int128,
-#endif
-        2
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __uint128_t type
-            __attribute__ ((vsize (2, sizeof (__uint128_t))));
-        static constexpr std::size_t alignment = 2 * alignof (__uint128_t);
-        static constexpr std::size_t size      = 2 * sizeof (__uint128_t);
-#elif SIMD_HEADER_GNUG
-        typedef unsigned __int128 type
-            __attribute__ ((vsize (2, sizeof (unsigned __int128))));
-        static constexpr std::size_t alignment
-            = 2 * alignof (unsigned __int128);
-        static constexpr std::size_t size = 2 * sizeof (unsigned __int128);
-#endif
-    };
-
-template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __uint128_t,
-#elif SIMD_HEADER_GNUG
-        unsigned __int128,
-#endif
-        4
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __uint128_t type
-            __attribute__ ((vsize (4, sizeof (__uint128_t))));
-        static constexpr std::size_t alignment = 4 * alignof (__uint128_t);
-        static constexpr std::size_t size      = 4 * sizeof (__uint128_t);
-#elif SIMD_HEADER_GNUG
-        typedef unsigned __int128 type
-            __attribute__ ((vsize (4, sizeof (unsigned __int128))));
-        static constexpr std::size_t alignment
-            = 4 * alignof (unsigned __int128);
-        static constexpr std::size_t size = 4 * sizeof (unsigned __int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __uint128_t,
-#elif SIMD_HEADER_GNUG
-        unsigned __int128,
-#endif
-        8
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __uint128_t type
-            __attribute__ ((vsize (8, sizeof (__uint128_t))));
-        static constexpr std::size_t alignment = 8 * alignof (__uint128_t);
-        static constexpr std::size_t size      = 8 * sizeof (__uint128_t);
-#elif SIMD_HEADER_GNUG
-        typedef unsigned __int128 type
-            __attribute__ ((vsize (8, sizeof (unsigned __int128))));
-        static constexpr std::size_t alignment
-            = 8 * alignof (unsigned __int128);
-        static constexpr std::size_t size = 8 * sizeof (unsigned __int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __uint128_t,
-#elif SIMD_HEADER_GNUG
-        unsigned __int128,
-#endif
-        16
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __uint128_t type
-            __attribute__ ((vsize (16, sizeof (__uint128_t))));
-        static constexpr std::size_t alignment = 16 * alignof (__uint128_t);
-        static constexpr std::size_t size      = 16 * sizeof (__uint128_t);
-#elif SIMD_HEADER_GNUG
-        typedef unsigned __int128 type
-            __attribute__ ((vsize (16, sizeof (unsigned __int128))));
-        static constexpr std::size_t alignment
-            = 16 * alignof (unsigned __int128);
-        static constexpr std::size_t size = 16 * sizeof (unsigned __int128);
-#endif
-    };
-
-template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-        __uint128_t,
-#elif SIMD_HEADER_GNUG
-        unsigned __int128,
-#endif
-        32
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __uint128_t type
-            __attribute__ ((vsize (32, sizeof (__uint128_t))));
-        static constexpr std::size_t alignment
-            = 32 * alignof (__uint128_t);
-        static constexpr std::size_t size = 32 * sizeof (__uint128_t);
-#elif SIMD_HEADER_GNUG
-        typedef unsigned __int128 type
-            __attribute__ ((vsize (32, sizeof (unsigned __int128))));
-        static constexpr std::size_t alignment
-            = 32 * alignof (unsigned __int128);
-        static constexpr std::size_t size = 32 * sizeof (unsigned __int128);
-#endif
-    };
-
-    template <>
-    struct vector_type_specialization <
-#if SIMD_HEADER_CLANG
-         __uint128_t,
-#elif SIMD_HEADER_GNUG
-        unsigned __int128,
-#endif
-        64
-    >
-    {
-#if SIMD_HEADER_CLANG
-        typedef __uint128_t type
-            __attribute__ ((vsize (64, sizeof (__uint128_t))));
-        static constexpr std::size_t alignment = 64 * alignof (__uint128_t);
-        static constexpr std::size_t size      = 64 * sizeof (__uint128_t);
-#elif SIMD_HEADER_GNUG
-        typedef unsigned __int128 type
-            __attribute__ ((vsize (64, sizeof (unsigned __int128))));
-        static constexpr std::size_t alignment
-            = 64 * alignof (unsigned __int128);
-        static constexpr std::size_t size = 64 * sizeof (unsigned __int128);
-#endif
-    };
+#if defined (__SIZEOF_INT128__)
+    specialize(i128, 1)
+    specialize(i128, 2)
+    specialize(i128, 4)
+    specialize(i128, 8)
+    specialize(i128, 16)
+    specialize(i128, 32)
+    specialize(i128, 64)
+
+    specialize(u128, 1)
+    specialize(u128, 2)
+    specialize(u128, 4)
+    specialize(u128, 8)
+    specialize(u128, 16)
+    specialize(u128, 32)
+    specialize(u128, 64)
+#endif   // defined (__SIZEOF_INT128__)
 
+#undef specialize
 #undef vsize
 
     template <typename T, std::size_t lanes>
@@ -918,10 +731,10 @@ template <>
                         sizeof (T) == 16 ||
                         sizeof (T) == 12 ||
                         sizeof (T) == 10,
-#if SIMD_HEADER_CLANG
-                        __int128_t,
-#elif SIMD_HEADER_GNUG
-                        __int128,
+#if defined (__SIZEOF_INT128__)
+                        i128,
+#else
+                        void,
 #endif
                         void
                     >::type
@@ -947,10 +760,10 @@ template <>
                         sizeof (T) == 16 ||
                         sizeof (T) == 12 ||
                         sizeof (T) == 10,
-#if SIMD_HEADER_CLANG
-                        __uint128_t,
-#elif SIMD_HEADER_GNUG
-                        unsigned __int128,
+#if defined (__SIZEOF_INT128__)
+                        u128,
+#else
+                        void,
 #endif
                         void
                     >::type
@@ -962,18 +775,16 @@ template <>
     template <typename T, std::size_t lanes>
     class simd_type_base
     {
-#if SIMD_HEADER_CLANG
+#if defined (__SIZEOF_INT128__)
         static_assert (
             std::is_arithmetic <T>::value ||
-                std::is_same <T, __int128_t>::value ||
-                std::is_same <T, __uint128_t>::value,
+                std::is_same <T, i128>::value ||
+                std::is_same <T, u128>::value,
             "template parameter typename T must be an arithmetic type"
         );
-#elif SIMD_HEADER_GNUG
+#else
         static_assert (
-            std::is_arithmetic <T>::value ||
-                std::is_same <T, __int128>::value ||
-                std::is_same <T, unsigned __int128>::value,
+            std::is_arithmetic <T>::value,
             "template parameter typename T must be an arithmetic type"
         );
 #endif
@@ -1008,6 +819,19 @@ template <>
             vext::vector <T, lanes>::alignment;
         static constexpr std::size_t size = vext::vector <T, lanes>::size;
 
+        /*
+         * The alignment of a SIMD vector type always covers the full width of
+         * the underlying vector payload, so a correctly aligned vector of up
+         * to 64 bytes never straddles a cache line boundary and each lane
+         * write in functions returning pairs of vectors (frexp, modf, div)
+         * lands on a single line.
+         */
+        static_assert (
+            alignment >= sizeof (vector_type_impl) ||
+                sizeof (vector_type_impl) > 64,
+            "SIMD vector payload must be aligned to its full width"
+        );
+
         simd_type_base (void) noexcept = default;
         simd_type_base (simd_type_base const &) noexcept = default;
 
@@ -1600,31 +1424,25 @@ template <>
     using simd_type = typename std::conditional <
         (std::is_integral <T>::value &&
             std::is_same <tag, arithmetic_tag>::value) ||
-#if SIMD_HEADER_CLANG
-        (std::is_same <T, __int128_t>::value &&
+#if defined (__SIZEOF_INT128__)
+        (std::is_same <T, i128>::value &&
             std::is_same <tag, arithmetic_tag>::value)||
-        (std::is_same <T, __uint128_t>::value &&
-            std::is_same <tag, arithmetic_tag>::value),
-#elif SIMD_HEADER_GNUG
-        (std::is_same <T, __int128>::value &&
-            std::is_same <tag, arithmetic_tag>::value)||
-        (std::is_same <T, unsigned __int128>::value &&
+        (std::is_same <T, u128>::value &&
             std::is_same <tag, arithmetic_tag>::value),
+#else
+        false,
 #endif
         integral_simd_type <T, lanes>,
         typename std::conditional <
             (std::is_integral <T>::value &&
                 std::is_same <tag, boolean_tag>::value) ||
-#if SIMD_HEADER_CLANG
-            (std::is_same <T, __int128_t>::value &&
-                std::is_same <tag, boolean_tag>::value) ||
-            (std::is_same <T, __uint128_t>::value &&
-                std::is_same <tag, boolean_tag>::value),
-#elif SIMD_HEADER_GNUG
-            (std::is_same <T, __int128>::value &&
+#if defined (__SIZEOF_INT128__)
+            (std::is_same <T, i128>::value &&
                 std::is_same <tag, boolean_tag>::value) ||
-            (std::is_same <T, unsigned __int128>::value &&
+            (std::is_same <T, u128>::value &&
                 std::is_same <tag, boolean_tag>::value),
+#else
+            false,
 #endif
             boolean_simd_type <T, lanes>,
             typename std::conditional <
@@ -1769,12 +1587,11 @@ template <>
     public:
         static_assert (
             std::is_integral <T>::value ||
-#if SIMD_HEADER_CLANG
-            std::is_same <T, __int128_t>::value ||
-            std::is_same <T, __uint128_t>::value,
-#elif SIMD_HEADER_GNUG
-            std::is_same <T, __int128>::value ||
-            std::is_same <T, unsigned __int128>::value,
+#if defined (__SIZEOF_INT128__)
+            std::is_same <T, i128>::value ||
+            std::is_same <T, u128>::value,
+#else
+            std::is_integral <T>::value,
 #endif
             "template parameter typename T must be an integral type"
         );
@@ -2127,12 +1944,13 @@ template <>
         }
 
         template <std::size_t N>
-        constexpr value_type value (void) const noexcept
+        simd_always_inline constexpr value_type value (void) const noexcept
         {
             return this->_vec [N];
         }
 
-        constexpr value_type value (std::size_t n) const noexcept
+        simd_always_inline constexpr value_type value (std::size_t n)
+            const noexcept
         {
             return this->_vec [n];
         }
@@ -3303,12 +3121,13 @@ template <>
         }
 
         template <std::size_t N>
-        constexpr value_type value (void) const noexcept
+        simd_always_inline constexpr value_type value (void) const noexcept
         {
             return this->_vec [N];
         }
 
-        constexpr value_type value (std::size_t n) const noexcept
+        simd_always_inline constexpr value_type value (std::size_t n)
+            const noexcept
         {
             return this->_vec [n];
         }
@@ -3795,6 +3614,21 @@ template <>
     };
 #pragma GCC diagnostic pop
 
+    /*
+     * Complex SIMD vectors store their lanes planar: one vector of real
+     * parts and one vector of imaginary parts, not the interleaved
+     * re,im,re,im layout of an array of std::complex. The arithmetic
+     * below therefore never shuffles -- a complex multiply is four lane
+     * multiplies, one subtract and one add over the two payload vectors,
+     * which the compilers contract into fused multiply-add forms where
+     * the target has them, where an interleaved representation spends
+     * most of its instruction budget on permutes around the same math.
+     * The interleaved layout exists only at the memory boundary: the
+     * `load`/`store` overloads taking `value_type` addresses read and
+     * write arrays of std::complex and split or merge the parts lane by
+     * lane, while the overloads taking two `vector_type` addresses move
+     * the planar payloads directly.
+     */
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wattributes"
     template <typename T, std::size_t l>
@@ -4636,12 +4470,13 @@ template <>
         }
 
         template <std::size_t N>
-        constexpr value_type value (void) const noexcept
+        simd_always_inline constexpr value_type value (void) const noexcept
         {
             return value_type {this->_realvec [N], this->_imagvec [N]};
         }
 
-        constexpr value_type value (std::size_t n) const noexcept
+        simd_always_inline constexpr value_type value (std::size_t n)
+            const noexcept
         {
             return value_type {this->_realvec [n], this->_imagvec [n]};
         }
@@ -5388,12 +5223,13 @@ template <>
         }
 
         template <std::size_t N>
-        constexpr value_type value (void) const noexcept
+        simd_always_inline constexpr value_type value (void) const noexcept
         {
             return this->_vec [N];
         }
 
-        constexpr value_type value (std::size_t n) const noexcept
+        simd_always_inline constexpr value_type value (std::size_t n)
+            const noexcept
         {
             return this->_vec [n];
         }
@@ -5748,6 +5584,49 @@ template <>
             return this->none_of_impl (util::lane_tag <lanes> {});
         }
 
+        /*
+         * Packs the boolean vector into an unsigned integer holding one bit
+         * per lane, bit i reflecting lane i. This is the natural form for
+         * keeping many lane masks around: the vector representation stores a
+         * full integral_type per lane while the packed form stores a single
+         * bit, and the packed value feeds ordinary integer tests and
+         * branches directly. Lane counts beyond 64 do not fit the packed
+         * form and fail to compile.
+         */
+        cpp14_constexpr unsigned long long bitmask (void) const noexcept
+        {
+            static_assert (
+                lanes <= 64,
+                "cannot pack a boolean vector of more than 64 lanes"
+            );
+
+            unsigned long long mask = 0;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                mask |= static_cast <unsigned long long> (
+                    this->_vec [i] ? 1 : 0
+                ) << i;
+            }
+
+            return mask;
+        }
+
+        /*
+         * Rebuilds a boolean vector from the packed form produced by
+         * bitmask, setting lane i from bit i.
+         */
+        static cpp14_constexpr boolean_simd_type
+            from_bitmask (unsigned long long mask) noexcept
+        {
+            boolean_simd_type result;
+            for (std::size_t i = 0; i < lanes; ++i) {
+                result._vec [i] = static_cast <integral_type> (
+                    (mask >> i) & 1
+                );
+            }
+
+            return result;
+        }
+
     private:
         template <std::size_t ... L>
         constexpr boolean_simd_type normalize_impl (util::index_sequence <L...>)
@@ -7578,10 +7457,385 @@ namespace detail
     }
 
     /*
-     * General iterator for SIMD vector types constructed either from a pointer
-     * to a contiguous array of scalars in memory or a pointer to a contiguous
-     * array of SIMD vector types in memory. This iterator does not assume the
-     * contents in memory are aligned to the requirements of the SIMD type.
+     * Reduction-style names for the boolean lane reductions, for call sites
+     * folding a predicate vector into a branch condition. These are the
+     * same computations as any_of and all_of: the unrolled chains over the
+     * normalized 0/1 lanes compile to branchless vector-extract/or (or and)
+     * sequences feeding one test on both supported compilers, which is also
+     * the form the aarch64 backends match onto their across-lane reduction
+     * instructions.
+     */
+    template <typename BooleanSIMDType>
+    constexpr bool reduce_or (BooleanSIMDType const & sv) noexcept
+    {
+        return sv.any_of ();
+    }
+
+    template <typename BooleanSIMDType>
+    constexpr bool reduce_and (BooleanSIMDType const & sv) noexcept
+    {
+        return sv.all_of ();
+    }
+
+    /*
+     * Loads a SIMD vector from an aligned vector address with a
+     * non-temporal (streaming) hint, for bulk pipelines whose data is used
+     * once and should not evict the cache-resident working set. The
+     * interface mirrors the `load_aligned (vector_type const *)` class
+     * overloads: the caller hands an address of whole vectors and is
+     * responsible for its alignment to the SIMD type's alignment value.
+     * Clang lowers the hint to the target's streaming instructions (for
+     * example movntdqa on x86-64); GCC has no generic non-temporal builtin,
+     * so the helper degrades to an ordinary aligned load there, which is
+     * correct just without the cache bypass.
+     */
+    template <typename SIMDType>
+    simd_always_inline SIMDType stream_load (
+        typename simd_traits <SIMDType>::vector_type const * addr
+    ) noexcept
+    {
+        static_assert (
+            detail::is_simd_type <SIMDType>::value,
+            "template parameter SIMDType must be a SIMD vector type"
+        );
+
+        using vector_type = typename simd_traits <SIMDType>::vector_type;
+
+        auto const aligned_addr = static_cast <vector_type const *> (
+            __builtin_assume_aligned (addr, simd_traits <SIMDType>::alignment)
+        );
+
+#if simd_has_nontemporal
+        return SIMDType {__builtin_nontemporal_load (aligned_addr)};
+#else
+        return SIMDType {*aligned_addr};
+#endif
+    }
+
+    /*
+     * Stores a SIMD vector to an aligned vector address with a
+     * non-temporal (streaming) hint; see stream_load above for the
+     * alignment contract and per-compiler behavior. Streaming stores are
+     * weakly ordered: issue a std::atomic_thread_fence (release) before
+     * other threads read the stored data.
+     *
+     * Only use the streaming hint for destinations that will not be read
+     * back soon (serialization sinks, frame buffers, and the like): a
+     * non-temporal store followed by an immediate reload of the same line
+     * is strictly slower than a regular store, since the data bypasses
+     * the cache hierarchy on the way out.
+     */
+    template <typename SIMDType>
+    simd_always_inline void stream_store (
+        typename simd_traits <SIMDType>::vector_type * addr,
+        SIMDType const & sv
+    ) noexcept
+    {
+        static_assert (
+            detail::is_simd_type <SIMDType>::value,
+            "template parameter SIMDType must be a SIMD vector type"
+        );
+
+        using vector_type = typename simd_traits <SIMDType>::vector_type;
+
+        auto const aligned_addr = static_cast <vector_type *> (
+            __builtin_assume_aligned (addr, simd_traits <SIMDType>::alignment)
+        );
+
+#if simd_has_nontemporal
+        __builtin_nontemporal_store (sv.data (), aligned_addr);
+#else
+        *aligned_addr = sv.data ();
+#endif
+    }
+
+    /*
+     * Loads one lane per index from a scalar base address: lane i of the
+     * result is base [index.value (i)]. Together with the overloaded
+     * operators, the wrappers in namespace math, and the width-generic
+     * aliases in namespace best, this rounds out the universal (width and
+     * technology agnostic) interface of this header: the same gather call
+     * compiles for any lane type and lane count. The indices are not
+     * bounds checked; every index must refer into an object reachable
+     * from base. The lowering is a per-lane extract/load/insert sequence,
+     * which is also what the hardware gather instructions decompose into
+     * on most implementations; do not expect gathers to beat contiguous
+     * loads, and prefer `load` whenever the access pattern allows it.
+     */
+    template <typename T, typename IndexSIMDType>
+    simd_always_inline simd_type <T, simd_traits <IndexSIMDType>::lanes>
+        gather (T const * base, IndexSIMDType const & index) noexcept
+    {
+        static_assert (
+            detail::is_simd_type <IndexSIMDType>::value,
+            "template parameter IndexSIMDType must be a SIMD vector type"
+        );
+
+        static_assert (
+            std::is_integral <
+                typename simd_traits <IndexSIMDType>::value_type
+            >::value,
+            "gather indices must have integral lanes"
+        );
+
+        constexpr std::size_t lanes = simd_traits <IndexSIMDType>::lanes;
+
+        T buffer [lanes];
+        for (std::size_t i = 0; i < lanes; ++i) {
+            buffer [i] = base [index.value (i)];
+        }
+
+        return simd_type <T, lanes>::load (buffer);
+    }
+
+    /*
+     * Stores one lane per index to a scalar base address: lane i of the
+     * vector is written to base [index.value (i)]. The counterpart to
+     * gather above, with the same contract: indices are not bounds
+     * checked, and when two indices compare equal the lane with the
+     * higher position wins, matching the order of the underlying scalar
+     * stores. The same performance caveat applies; prefer `store` for
+     * contiguous destinations.
+     */
+    template <typename SIMDType, typename IndexSIMDType>
+    simd_always_inline void scatter (
+        typename simd_traits <SIMDType>::value_type * base,
+        IndexSIMDType const & index,
+        SIMDType const & sv
+    ) noexcept
+    {
+        static_assert (
+            detail::is_simd_type <SIMDType>::value &&
+                detail::is_simd_type <IndexSIMDType>::value,
+            "template parameters SIMDType and IndexSIMDType must be SIMD"
+            " vector types"
+        );
+
+        static_assert (
+            std::is_integral <
+                typename simd_traits <IndexSIMDType>::value_type
+            >::value,
+            "scatter indices must have integral lanes"
+        );
+
+        static_assert (
+            simd_traits <SIMDType>::lanes ==
+                simd_traits <IndexSIMDType>::lanes,
+            "cannot scatter across SIMD vectors of different lengths"
+        );
+
+        constexpr std::size_t lanes = simd_traits <SIMDType>::lanes;
+
+        for (std::size_t i = 0; i < lanes; ++i) {
+            base [index.value (i)] = sv.value (i);
+        }
+    }
+
+    /*
+     * Four-way widening dot product with accumulation, the inner
+     * operation of quantized (int8) matrix kernels: lane i of the result
+     * is acc lane i plus the dot product of lanes 4i through 4i + 3 of u
+     * and v, with every product computed at the accumulator's lane width
+     * so narrow multiplies cannot overflow. The shape matches the
+     * hardware dot product instructions -- 64 8-bit by 8-bit products
+     * folding into 16 32-bit sums is one VNNI vpdpbusd on x86 and the
+     * corresponding sdot/udot arrangement on ARM -- but the lowering
+     * here is the portable widen-multiply-add sequence; as elsewhere in
+     * this header, whether the target contracts it into its dot product
+     * instruction is the compiler's call. The input vectors may differ
+     * in signedness (the x86 instruction itself is unsigned by signed);
+     * each factor converts to the accumulator lane type before the
+     * multiply.
+     */
+    template <typename USIMDType, typename VSIMDType, typename AccSIMDType>
+    simd_always_inline AccSIMDType dot (USIMDType const & u,
+                                        VSIMDType const & v,
+                                        AccSIMDType const & acc) noexcept
+    {
+        static_assert (
+            detail::is_simd_type <USIMDType>::value &&
+                detail::is_simd_type <VSIMDType>::value &&
+                detail::is_simd_type <AccSIMDType>::value,
+            "template parameters USIMDType, VSIMDType and AccSIMDType must"
+            " be SIMD vector types"
+        );
+
+        static_assert (
+            std::is_integral <
+                typename simd_traits <USIMDType>::value_type
+            >::value &&
+            std::is_integral <
+                typename simd_traits <VSIMDType>::value_type
+            >::value &&
+            std::is_integral <
+                typename simd_traits <AccSIMDType>::value_type
+            >::value,
+            "dot product lanes must be integral"
+        );
+
+        static_assert (
+            simd_traits <USIMDType>::lanes == simd_traits <VSIMDType>::lanes,
+            "cannot compute dot product across SIMD vectors of different"
+            " lengths"
+        );
+
+        static_assert (
+            simd_traits <USIMDType>::lanes ==
+                4 * simd_traits <AccSIMDType>::lanes,
+            "dot product folds four input lanes per accumulator lane"
+        );
+
+        using acc_type = typename simd_traits <AccSIMDType>::value_type;
+        constexpr std::size_t lanes = simd_traits <AccSIMDType>::lanes;
+
+        acc_type buffer [lanes];
+        for (std::size_t i = 0; i < lanes; ++i) {
+            acc_type sum = acc.value (i);
+            for (std::size_t k = 0; k < 4; ++k) {
+                sum += static_cast <acc_type> (u.value (4 * i + k)) *
+                       static_cast <acc_type> (v.value (4 * i + k));
+            }
+            buffer [i] = sum;
+        }
+
+        return AccSIMDType::load (buffer);
+    }
+
+    /*
+     * Widest vector width, in bytes, the executing processor supports with
+     * full hardware backing, queried at runtime. As the Implementation
+     * Notes discuss, every entry point in this header is a template and so
+     * cannot carry target_clones or ifunc based multi-versioning; the
+     * supported pattern is to compile the consuming translation units once
+     * per target setting and select between them at startup. This helper is
+     * the selection half of that pattern: call it once at startup and route
+     * into the translation unit whose vectors match. On non-x86 targets,
+     * where the cpu_supports builtin is unavailable, the answer is the
+     * compile time register width, which is exact whenever the binary only
+     * runs where it was built to run.
+     */
+    inline std::size_t preferred_vector_bytes (void) noexcept
+    {
+#if defined (__x86_64__) || defined (__i386__)
+        if (__builtin_cpu_supports ("avx512f")) {
+            return 64;
+        }
+        if (__builtin_cpu_supports ("avx2")) {
+            return 32;
+        }
+        if (__builtin_cpu_supports ("sse2")) {
+            return 16;
+        }
+        return 8;
+#elif defined (__AVX512F__)
+        return 64;
+#elif defined (__AVX__)
+        return 32;
+#elif defined (__SSE2__) || defined (__ARM_NEON) || defined (__ALTIVEC__)
+        return 16;
+#else
+        return 8;
+#endif
+    }
+
+    /*
+     * Runtime capabilities of the executing processor, one flag per
+     * technology namespace in this header. On x86 the flags come from the
+     * cpu_supports builtin, whose libgcc/compiler-rt probe also verifies
+     * through XGETBV that the operating system has enabled the matching
+     * register state, so avx reads false when the hardware supports it
+     * but the OS saves no ymm state. On other targets no runtime probe is
+     * available portably and the flags reduce to the compile time target,
+     * which is exact whenever the binary only runs where it was built to
+     * run. The avx512 flag mirrors the namespace and means avx512f; probe
+     * finer subsets directly with __builtin_cpu_supports where needed.
+     */
+    struct cpu_features
+    {
+        bool mmx;
+        bool sse;
+        bool sse2;
+        bool sse3;
+        bool ssse3;
+        bool sse4;
+        bool sse4a;
+        bool avx;
+        bool avx2;
+        bool avx512;
+        bool neon;
+        bool sve;
+        bool rvv;
+    };
+
+    /*
+     * Accessor for the executing processor's capabilities; the probe runs
+     * once on first call. Use at startup to pick between translation
+     * units compiled for different targets (see preferred_vector_bytes
+     * above for that pattern), or with require below to fail fast when a
+     * binary built for one target starts on a processor lacking it.
+     */
+    inline cpu_features const & cpu (void) noexcept
+    {
+        static cpu_features const features = {
+#if defined (__x86_64__) || defined (__i386__)
+            static_cast <bool> (__builtin_cpu_supports ("mmx")),
+            static_cast <bool> (__builtin_cpu_supports ("sse")),
+            static_cast <bool> (__builtin_cpu_supports ("sse2")),
+            static_cast <bool> (__builtin_cpu_supports ("sse3")),
+            static_cast <bool> (__builtin_cpu_supports ("ssse3")),
+            static_cast <bool> (__builtin_cpu_supports ("sse4.1")) &&
+                static_cast <bool> (__builtin_cpu_supports ("sse4.2")),
+            static_cast <bool> (__builtin_cpu_supports ("sse4a")),
+            static_cast <bool> (__builtin_cpu_supports ("avx")),
+            static_cast <bool> (__builtin_cpu_supports ("avx2")),
+            static_cast <bool> (__builtin_cpu_supports ("avx512f")),
+#else
+            false, false, false, false, false, false, false, false, false,
+            false,
+#endif
+#if defined (__ARM_NEON)
+            true,
+#else
+            false,
+#endif
+#if defined (__ARM_FEATURE_SVE)
+            true,
+#else
+            false,
+#endif
+#if defined (__riscv_vector)
+            true
+#else
+            false
+#endif
+        };
+
+        return features;
+    }
+
+    /*
+     * Guard for kernels with a hard processor requirement: aborts with a
+     * diagnostic on stderr when the required feature is absent, turning a
+     * mid-computation SIGILL into a descriptive failure at startup.
+     *
+     *      simd::require (simd::cpu ().avx2, "avx2");
+     */
+    inline void require (bool feature, char const * name) noexcept
+    {
+        if (!feature) {
+            std::fputs ("simd: required processor feature unavailable: ",
+                        stderr);
+            std::fputs (name, stderr);
+            std::fputs ("\n", stderr);
+            std::abort ();
+        }
+    }
+
+    /*
+     * General iterator for SIMD vector types constructed either from a pointer
+     * to a contiguous array of scalars in memory or a pointer to a contiguous
+     * array of SIMD vector types in memory. This iterator does not assume the
+     * contents in memory are aligned to the requirements of the SIMD type.
      *
      * This iterator conforms to the ContiguousIterator concept and, if the
      * provided template parameter is not const-qualified, OutputIterator
@@ -7824,17 +8078,41 @@ namespace detail
 #endif
         pointer allocate (size_type n, void const *)
         {
-            return new value_type [n];
+            return this->allocate (n);
         }
 
+        /*
+         * Storage is obtained directly from the aligned allocation
+         * helpers rather than through array new on the vector type: an
+         * allocator hands out raw memory for the container to construct
+         * into, so running the element constructors here was wasted
+         * work, and the direct call sidesteps any array cookie placed in
+         * front of the elements. The over-alignment guarantee is the
+         * same one the class operator new [] provides.
+         */
         value_type * allocate (size_type n) const
         {
-            return new value_type [n];
+            /*
+             * The assume_aligned wrap hands the alignment guarantee to
+             * the optimizer at every use of the returned pointer, so
+             * loads and stores through container storage compile to
+             * their aligned forms without peeling.
+             */
+            return static_cast <value_type *> (
+                __builtin_assume_aligned (
+                    detail::util::aligned_allocate (
+                        n * sizeof (value_type), value_type::alignment
+                    ),
+                    value_type::alignment
+                )
+            );
         }
 
-        void deallocate (value_type * p, std::size_t) const noexcept
+        void deallocate (value_type * p, std::size_t n) const noexcept
         {
-            value_type::operator delete [] (p);
+            detail::util::aligned_deallocate (
+                p, n * sizeof (value_type), value_type::alignment
+            );
         }
 
 #if __cplusplus > 201402L
@@ -7965,7 +8243,7 @@ namespace detail
     template <
         std::size_t ... L, typename F, typename SIMDType
     >
-    constexpr transform_result <F, SIMDType>
+    simd_always_inline constexpr transform_result <F, SIMDType>
         transform_impl (util::index_sequence <L...>,
                         F && f, SIMDType const & sv)
         noexcept (noexcept (
@@ -7988,7 +8266,7 @@ namespace detail
     template <
         std::size_t ... L, typename F, typename SIMDType1, typename SIMDType2
     >
-    constexpr transform_result <F, SIMDType1, SIMDType2>
+    simd_always_inline constexpr transform_result <F, SIMDType1, SIMDType2>
         transform_impl (util::index_sequence <L...>, F && f,
                         SIMDType1 const & sv1, SIMDType2 const & sv2)
         noexcept (noexcept (
@@ -8022,6 +8300,7 @@ namespace detail
         std::size_t ... L, typename F,
         typename SIMDType1, typename SIMDType2, typename SIMDType3
     >
+    simd_always_inline
     constexpr transform_result <F, SIMDType1, SIMDType2, SIMDType3>
         transform_impl (util::index_sequence <L...>, F && f,
                         SIMDType1 const & sv1,
@@ -8068,6 +8347,7 @@ namespace detail
         typename SIMDType1, typename SIMDType2,
         typename SIMDType3, typename SIMDType4
     >
+    simd_always_inline
     constexpr transform_result <F, SIMDType1, SIMDType2, SIMDType3, SIMDType4>
         transform_impl (util::index_sequence <L...>, F && f,
                         SIMDType1 const & sv1,
@@ -8125,7 +8405,7 @@ namespace detail
      * collection of lane values of the original SIMD vectors.
      */
     template <typename F, typename ... SIMDTypes>
-    constexpr detail::transform_result <F, SIMDTypes...>
+    simd_always_inline constexpr detail::transform_result <F, SIMDTypes...>
         transform (F && f, SIMDTypes const &... sv)
         noexcept (noexcept (
             std::forward <F> (f) (
@@ -8144,6 +8424,45 @@ namespace detail
         );
     }
 
+    /*
+     * Compute a new SIMD vector containing the function results of each
+     * collection of lane values of the original SIMD vectors, walking the
+     * lanes with a countable loop rather than the pack expansion transform
+     * uses. The loop form is what the auto-vectorizers recognize when the
+     * applied function has a declared vector variant, letting builds with
+     * the appropriate flags (for example -ffast-math against glibc's
+     * libmvec on x86-64) batch a whole vector of libm calls into a single
+     * _ZGV* call instead of one call per lane; without such flags the loop
+     * unrolls to exactly the per-lane calls transform makes. Not usable in
+     * constant expressions, which is why the constexpr callers in this
+     * header stay on transform.
+     */
+    template <typename F, typename ... SIMDTypes>
+    simd_always_inline detail::transform_result <F, SIMDTypes...>
+        batch_transform (F && f, SIMDTypes const &... sv)
+        noexcept (noexcept (
+            std::forward <F> (f) (
+                std::declval <
+                    typename simd::simd_traits <SIMDTypes>::value_type
+                > () ...
+            )
+        ))
+    {
+        using common_lanes =
+            typename detail::common_lane_count <SIMDTypes...>::type;
+        using result_type = detail::transform_result <F, SIMDTypes...>;
+        using result_value_type =
+            typename simd_traits <result_type>::value_type;
+
+        /* the array is left uninitialized; every entry is written below */
+        std::array <result_value_type, common_lanes::value> results;
+        for (std::size_t i = 0; i < common_lanes::value; ++i) {
+            results [i] = f (sv.value (i)...);
+        }
+
+        return result_type {results};
+    }
+
     /*
      * Compute a new SIMD vector containing the hash values of each lane of the
      * original SIMD vector, optionally with a provided hash function.
@@ -8184,13 +8503,57 @@ namespace detail
         }
     };
 
+namespace detail
+{
+    /*
+     * Cached result type of the promoting <cmath> functions. Every wrapper in
+     * namespace math previously spelled out its own
+     * `decltype (std::fn (std::declval <value_type> ()))` return type, forcing
+     * the compiler to redo the same overload resolution in each wrapper for
+     * each value type. All of the one and two argument promoting functions
+     * promote identically, so the resolution is hoisted here and performed
+     * once per value type.
+     */
+    template <typename ...>
+    struct transcendental_result;
+
+    /*
+     * Whether a lane type is an IEC 60559 (IEEE-754) binary32 or binary64
+     * format. The classification, comparison and bit manipulation fast
+     * paths in namespace math dispatch on this: it folds to a constant at
+     * instantiation time, it admits exactly the two formats whose layouts
+     * the integer kernels assume, and it routes soft-float or otherwise
+     * non-conforming targets to the scalar semantics.
+     */
+    template <typename T>
+    struct iec559_value : std::integral_constant <
+        bool,
+        std::numeric_limits <T>::is_iec559 &&
+            (sizeof (T) == 4 || sizeof (T) == 8)
+    > {};
+
+    template <typename T>
+    struct transcendental_result <T>
+    {
+        using type = decltype (std::exp (std::declval <T> ()));
+    };
+
+    template <typename T, typename U>
+    struct transcendental_result <T, U>
+    {
+        using type = decltype (
+            std::pow (std::declval <T> (), std::declval <U> ())
+        );
+    };
+}   // namespace detail
+
 namespace math
 {
     /*
      * Computes the sum across the SIMD vector by the given binary operation.
      */
     template <typename SIMDType, typename U, typename BinaryOp>
-    U accumulate (SIMDType const & v, U init, BinaryOp op)
+    simd_always_inline U accumulate (SIMDType const & v, U init, BinaryOp op)
     {
         return std::accumulate (v.begin (), v.end (), init, op);
     }
@@ -8199,6 +8562,7 @@ namespace math
      * Computes the inner product of two arithmetic (non-boolean) SIMD vectors.
      */
     template <typename SIMDType, std::size_t lanes>
+    simd_always_inline
     auto inner_product (SIMDType const & sv1, SIMDType const & sv2) noexcept
         -> typename simd_traits <SIMDType>::value_type
     {
@@ -8214,7 +8578,7 @@ namespace math
      * Returns a SIMD vector of the real components of a complex SIMD vector.
      */
     template <typename ComplexSIMDType>
-    constexpr auto real (ComplexSIMDType const & sv) noexcept
+    simd_always_inline constexpr auto real (ComplexSIMDType const & sv) noexcept
         -> decltype (sv.real ())
     {
         return sv.real ();
@@ -8224,7 +8588,7 @@ namespace math
      * Returns a SIMD vector of the real components of a complex SIMD vector.
      */
     template <typename ComplexSIMDType>
-    constexpr auto imag (ComplexSIMDType const & sv) noexcept
+    simd_always_inline constexpr auto imag (ComplexSIMDType const & sv) noexcept
         -> decltype (sv.imag ())
     {
         return sv.imag ();
@@ -8235,20 +8599,15 @@ namespace math
      * quotient and remainder of integral division.
      */
     template <typename SIMDType>
-    std::pair <SIMDType, SIMDType>
+    simd_always_inline std::pair <SIMDType, SIMDType>
         div (SIMDType const & u, SIMDType const & v) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-
-        std::pair <SIMDType, SIMDType> qr;
-
-        for (std::size_t i = 0; i < traits_type::lanes; ++i) {
-            auto const result = std::div (u.value (i), v.value (i));
-            qr.first.set  (i, result.quot);
-            qr.second.set (i, result.rem);
-        }
-
-        return qr;
+        /*
+         * Integral division and remainder truncate toward zero exactly as
+         * std::div does, so both halves can be computed with whole-vector
+         * operations rather than a scalar lane loop over std::div.
+         */
+        return std::pair <SIMDType, SIMDType> {u / v, u % v};
     }
 
     /*
@@ -8256,7 +8615,7 @@ namespace math
      * std::abs.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::abs (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -8266,7 +8625,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::abs (a); }, v
         );
     }
@@ -8276,7 +8635,7 @@ namespace math
      * std::fabs.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::fabs (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -8286,7 +8645,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::fabs (a); }, v
         );
     }
@@ -8295,7 +8654,7 @@ namespace math
      * Computes the phase angle for each lane of a complex SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::arg (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -8305,7 +8664,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::arg (a); }, v
         );
     }
@@ -8315,18 +8674,18 @@ namespace math
      * SIMD vectors without undue underflow or overflow in intermediate steps.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::hypot (
-            std::declval <typename simd_traits <SIMDType>::value_type> (),
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > hypot (SIMDType const & u, SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) noexcept {
                 return std::hypot (a, b);
             },
@@ -8341,7 +8700,7 @@ namespace math
      * steps.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::hypot (
             std::declval <typename simd_traits <SIMDType>::value_type> (),
             std::declval <typename simd_traits <SIMDType>::value_type> (),
@@ -8370,7 +8729,7 @@ namespace math
      * Computes the euclidean norm for each lane of a complex SIMD vector.
      */
     template <typename ComplexSIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <ComplexSIMDType>::lane_type,
         simd_traits <ComplexSIMDType>::lanes
     > norm (ComplexSIMDType const & v) noexcept
@@ -8382,6 +8741,7 @@ namespace math
      * Computes the complex conjugate for each lane of a complex SIMD vector.
      */
     template <typename ComplexSIMDType>
+    simd_always_inline
     constexpr ComplexSIMDType conj (ComplexSIMDType const & v) noexcept
     {
         return ComplexSIMDType {v.real (), -v.imag ()};
@@ -8392,7 +8752,7 @@ namespace math
      * complex SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::proj (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -8402,7 +8762,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::proj (a); }, v
         );
     }
@@ -8411,17 +8771,17 @@ namespace math
      * Computes the exponential for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::exp (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > exp (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::exp (a); }, v
         );
     }
@@ -8430,17 +8790,17 @@ namespace math
      * Computes the exponent base 2 for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::exp2 (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > exp2 (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::exp2 (a); }, v
         );
     }
@@ -8449,17 +8809,17 @@ namespace math
      * Computes the exponential minus 1 for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::expm1 (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > expm1 (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::expm1 (a); }, v
         );
     }
@@ -8469,17 +8829,17 @@ namespace math
      * For complex types branch cuts occur along the negative real axis.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::log (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > log (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::log (a); }, v
         );
     }
@@ -8489,17 +8849,17 @@ namespace math
      * For complex types branch cuts occur along the negative real axis.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::log10 (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > log10 (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::log10 (a); }, v
         );
     }
@@ -8508,17 +8868,17 @@ namespace math
      * Computes the logarithm base 2 for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::log2 (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > log2 (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::log2 (a); }, v
         );
     }
@@ -8528,17 +8888,17 @@ namespace math
      * plus one.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::log1p (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > log1p (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::log1p (a); }, v
         );
     }
@@ -8548,17 +8908,17 @@ namespace math
      * For complex types the result lies in the right half-plane.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::sqrt (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > sqrt (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::sqrt (a); }, v
         );
     }
@@ -8567,30 +8927,94 @@ namespace math
      * Computes the cube root for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::cbrt (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > cbrt (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::cbrt (a); }, v
         );
     }
 
+    /*
+     * Attempts to compute pow through a cheaper equivalent when the exponent
+     * vector is a broadcast of a recognized constant (1, 2, 1/2, -1, -1/2).
+     * Only enabled (through the trailing tag) when base and exponent share a
+     * floating point value type, so the rewritten forms have exactly the
+     * return type of the generic path. Returns whether the result was
+     * produced.
+     */
+    template <typename SIMDType>
+    simd_always_inline bool
+    pow_constant_dispatch (SIMDType const & base, SIMDType const & exp,
+                           SIMDType & result, std::true_type) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+
+        auto const e = exp.value (0);
+        if (any_of (exp != SIMDType {e})) {
+            return false;
+        }
+
+        if (e == value_type {1}) {
+            result = base;
+        } else if (e == value_type {2}) {
+            result = base * base;
+        } else if (e == value_type {0.5} || e == value_type {-0.5}) {
+            /*
+             * The sqrt rewrites disagree with IEEE pow on zero and
+             * negative-infinity bases: pow (-0.0, 0.5) is +0.0 where
+             * sqrt (-0.0) is -0.0, pow (-inf, 0.5) is +inf where
+             * sqrt (-inf) is NaN, and pow (-0.0, -0.5) is +inf where
+             * 1 / sqrt (-0.0) is -inf. Lanes that may hit those cases
+             * (conservatively, any zero or negative infinity base) keep
+             * the generic std::pow path.
+             */
+            if (any_of (base == SIMDType {value_type {0}}) ||
+                any_of (base == SIMDType {
+                    -std::numeric_limits <value_type>::infinity ()
+                }))
+            {
+                return false;
+            }
+            result = e == value_type {0.5} ?
+                sqrt (base) :
+                SIMDType {value_type {1}} / sqrt (base);
+        } else if (e == value_type {-1}) {
+            result = SIMDType {value_type {1}} / base;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    template <typename SIMDTypeBase, typename SIMDTypeExp, typename SIMDType>
+    simd_always_inline bool
+    pow_constant_dispatch (SIMDTypeBase const &, SIMDTypeExp const &,
+                           SIMDType &, std::false_type) noexcept
+    {
+        return false;
+    }
+
     /*
      * Computes the power x^y for each lane, pairwise of two SIMD vectors.
+     * When the exponent vector broadcasts one of the constants 1, 2, 1/2,
+     * -1, or -1/2 across all lanes the computation is dispatched to the
+     * equivalent multiplication, square root, or reciprocal form, which is
+     * orders of magnitude cheaper than the generic per-lane std::pow.
      */
     template <typename SIMDTypeBase, typename SIMDTypeExp>
-    simd_type <
-        decltype (std::pow (
-            std::declval <typename simd_traits <SIMDTypeBase>::value_type> (),
-            std::declval <typename simd_traits <SIMDTypeExp>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDTypeBase>::value_type,
+            typename simd_traits <SIMDTypeExp>::value_type
+        >::type,
         simd_traits <SIMDTypeBase>::lanes
     > pow (SIMDTypeBase const & base, SIMDTypeExp const & exp) noexcept
     {
@@ -8605,30 +9029,50 @@ namespace math
             "cannot apply pow function to SIMD vectors of different lenghts"
         );
 
-        return transform (
-            [] (base_value_type const & b, exp_value_type const & e) noexcept
-            {
-                return std::pow (b, e);
-            },
-            base, exp
-        );
-    }
-
+        using result_type = simd_type <
+            typename detail::transcendental_result <
+                base_value_type, exp_value_type
+            >::type,
+            base_traits_type::lanes
+        >;
+        using dispatch_eligible = std::integral_constant <
+            bool,
+            std::is_floating_point <base_value_type>::value &&
+                std::is_same <SIMDTypeBase, result_type>::value &&
+                std::is_same <SIMDTypeExp, result_type>::value
+        >;
+
+        result_type result {};
+        if (pow_constant_dispatch (base, exp, result,
+                                   dispatch_eligible {}))
+        {
+            return result;
+        }
+
+        return batch_transform (
+            [] (base_value_type const & b, exp_value_type const & e) noexcept
+            {
+                return std::pow (b, e);
+            },
+            base, exp
+        );
+    }
+
     /*
      * Computes the sine for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::sin (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > sin (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::sin (a); }, v
         );
     }
@@ -8637,17 +9081,17 @@ namespace math
      * Computes the arcsine for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::asin (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > asin (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::asin (a); }, v
         );
     }
@@ -8656,17 +9100,17 @@ namespace math
      * Computes the cosine for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::cos (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > cos (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::cos (a); }, v
         );
     }
@@ -8675,36 +9119,93 @@ namespace math
      * Computes the arcosine for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::acos (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > acos (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::acos (a); }, v
         );
     }
 
+    /*
+     * Computes both the sine and the cosine for each lane of a SIMD vector in
+     * a single pass. Returns a pair of SIMD vectors containing the sine and
+     * cosine values, respectively; callers that need both avoid a second
+     * traversal of the input vector.
+     */
+    template <typename SIMDType>
+    simd_always_inline std::pair <
+        simd_type <
+            decltype (std::sin (
+                std::declval <typename simd_traits <SIMDType>::value_type> ()
+            )),
+            simd_traits <SIMDType>::lanes
+        >,
+        simd_type <
+            decltype (std::cos (
+                std::declval <typename simd_traits <SIMDType>::value_type> ()
+            )),
+            simd_traits <SIMDType>::lanes
+        >
+    > sincos (SIMDType const & v) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using result_type = std::pair <
+            simd_type <
+                decltype (std::sin (
+                    std::declval <typename traits_type::value_type> ()
+                )),
+                traits_type::lanes
+            >,
+            simd_type <
+                decltype (std::cos (
+                    std::declval <typename traits_type::value_type> ()
+                )),
+                traits_type::lanes
+            >
+        >;
+
+        using value_type = typename traits_type::value_type;
+        using sin_type   = decltype (std::sin (std::declval <value_type> ()));
+        using cos_type   = decltype (std::cos (std::declval <value_type> ()));
+
+        /* the arrays are left uninitialized; every entry is written below */
+        std::array <sin_type, traits_type::lanes> sines;
+        std::array <cos_type, traits_type::lanes> cosines;
+        for (std::size_t i = 0; i < traits_type::lanes; ++i) {
+            auto const a = v.value (i);
+            sines [i]   = std::sin (a);
+            cosines [i] = std::cos (a);
+        }
+
+        return result_type {
+            simd_type <sin_type, traits_type::lanes> {sines},
+            simd_type <cos_type, traits_type::lanes> {cosines}
+        };
+    }
+
     /*
      * Computes the tangent for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::tan (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > tan (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::tan (a); }, v
         );
     }
@@ -8713,17 +9214,17 @@ namespace math
      * Computes the arctangent for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::atan (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > atan (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::atan (a); }, v
         );
     }
@@ -8732,7 +9233,7 @@ namespace math
      * Computes the arctangent considering signs for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::atan2 (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -8742,7 +9243,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::atan2 (a); }, v
         );
     }
@@ -8751,17 +9252,17 @@ namespace math
      * Computes the hyperbolic sine for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::sinh (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > sinh (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::sinh (a); }, v
         );
     }
@@ -8770,17 +9271,17 @@ namespace math
      * Computes the area hyperbolic sine for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::asinh (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > asinh (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::asinh (a); }, v
         );
     }
@@ -8789,17 +9290,17 @@ namespace math
      * Computes the hyperbolic cosine for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::cosh (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > cosh (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::cosh (a); }, v
         );
     }
@@ -8808,17 +9309,17 @@ namespace math
      * Computes the area hyperbolic cosine for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::acosh (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > acosh (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::acosh (a); }, v
         );
     }
@@ -8827,17 +9328,17 @@ namespace math
      * Computes the hyperbolic tangent for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::tanh (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > tanh (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::tanh (a); }, v
         );
     }
@@ -8846,17 +9347,17 @@ namespace math
      * Computes the area hyperbolic tangent for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::atanh (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > atanh (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::atanh (a); }, v
         );
     }
@@ -8865,17 +9366,17 @@ namespace math
      * Computes the error function for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::erf (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > erf (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::erf (a); }, v
         );
     }
@@ -8884,17 +9385,17 @@ namespace math
      * Computes the complementary error function for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::erfc (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > erfc (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::erfc (a); }, v
         );
     }
@@ -8903,17 +9404,17 @@ namespace math
      * Computes the gamma function for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::tgamma (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > tgamma (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::tgamma (a); }, v
         );
     }
@@ -8923,17 +9424,17 @@ namespace math
      * SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::lgamma (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > lgamma (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::lgamma (a); }, v
         );
     }
@@ -8942,13 +9443,14 @@ namespace math
      * Computes the pairwise maximum of two SIMD vectors.
      */
     template <typename SIMDType>
+    simd_always_inline
     cpp14_constexpr SIMDType max (SIMDType const & u, SIMDType const & v)
         noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) cpp17_constexpr
             {
                 return std::max (a, b);
@@ -8961,13 +9463,14 @@ namespace math
      * Computes the pairwise minimum of two SIMD vectors.
      */
     template <typename SIMDType>
+    simd_always_inline
     cpp14_constexpr SIMDType min (SIMDType const & u, SIMDType const & v)
         noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) cpp17_constexpr
             {
                 return std::min (a, b);
@@ -8980,18 +9483,18 @@ namespace math
      * Computes the floating point pairwise maximum of two SIMD vectors.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::fmax (
-            std::declval <typename simd_traits <SIMDType>::value_type> (),
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > fmax (SIMDType const & u, SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) {
                 return std::fmax (a, b);
             },
@@ -9003,18 +9506,18 @@ namespace math
      * Computes the floating point pairwise minimum of two SIMD vectors.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::fmin (
-            std::declval <typename simd_traits <SIMDType>::value_type> (),
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > fmin (SIMDType const & u, SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) {
                 return std::fmin (a, b);
             },
@@ -9027,18 +9530,18 @@ namespace math
      * vectors.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::fdim (
-            std::declval <typename simd_traits <SIMDType>::value_type> (),
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > fdim (SIMDType const & u, SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) {
                 return std::fdim (a, b);
             },
@@ -9050,17 +9553,17 @@ namespace math
      * Computes the ceil for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::ceil (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > ceil (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::ceil (a); }, v
         );
     }
@@ -9069,17 +9572,17 @@ namespace math
      * Computes the floor for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::floor (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > floor (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::floor (a); }, v
         );
     }
@@ -9088,17 +9591,17 @@ namespace math
      * Computes the truncation value for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::trunc (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > trunc (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::trunc (a); }, v
         );
     }
@@ -9110,17 +9613,17 @@ namespace math
      * type is a non-floating point arithmetic type, the promoted type (double).
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::round (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > round (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::round (a); }, v
         );
     }
@@ -9131,7 +9634,7 @@ namespace math
      * vector of long values.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::lround (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -9141,7 +9644,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::lround (a); }, v
         );
     }
@@ -9152,7 +9655,7 @@ namespace math
      * vector of long long values.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::llround (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -9162,7 +9665,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::llround (a); }, v
         );
     }
@@ -9172,17 +9675,17 @@ namespace math
      * the current rounding mode.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::nearbyint (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > nearbyint (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::nearbyint (a); }, v
         );
     }
@@ -9194,17 +9697,17 @@ namespace math
      * non-floating point arithmetic type, the promoted type (double).
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::rint (
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
     > rint (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::rint (a); }, v
         );
     }
@@ -9215,7 +9718,7 @@ namespace math
      * long values.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::lrint (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -9225,7 +9728,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::lrint (a); }, v
         );
     }
@@ -9236,7 +9739,7 @@ namespace math
      * long long values.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::llrint (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -9246,46 +9749,122 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::llrint (a); }, v
         );
     }
 
     /*
-     * Computes the decomposition of a number into significand and a power of 2,
-     * returning a pair of SIMD vectors with the above values, respectively.
+     * Result of math::frexp; an aggregate of two SIMD vectors holding the
+     * normalized fractions and integral exponents of each lane. A dedicated
+     * aggregate is named at both construction and return, which makes the
+     * copy elision of the result reliable where the std::pair previously
+     * returned was built through its converting constructor.
      */
     template <typename SIMDType>
-    std::pair <
+    struct frexp_result
+    {
         simd_type <
             decltype (std::frexp (
                 std::declval <typename simd_traits <SIMDType>::value_type> (),
                 std::declval <int *> ()
             )),
             simd_traits <SIMDType>::lanes
-        >,
-        simd_type <int, simd_traits <SIMDType>::lanes>
-    > frexp (SIMDType const & v) noexcept
+        > fraction;
+        simd_type <int, simd_traits <SIMDType>::lanes> exponent;
+    };
+
+    /*
+     * Computes the decomposition of a number into significand and a power of 2,
+     * returning SIMD vectors with the above values in the fraction and
+     * exponent members of the result, respectively.
+     */
+    template <typename SIMDType>
+    simd_always_inline frexp_result <SIMDType>
+    frexp (SIMDType const & v) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
-        using result_type = std::pair <
-            simd_type <
-                decltype (std::frexp (
-                    std::declval <value_type> (), std::declval <int *> ()
-                )),
-                traits_type::lanes
-            >,
-            simd_type <int, traits_type::lanes>
-        >;
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using fraction_type = decltype (
+            std::frexp (std::declval <value_type> (), std::declval <int *> ())
+        );
 
-        result_type result {};
+        /* the arrays are left uninitialized; every entry is written below */
+        std::array <fraction_type, traits_type::lanes> fractions;
+        std::array <int, traits_type::lanes> exponents;
         for (std::size_t i = 0; i < traits_type::lanes; ++i) {
-            int exp;
-            result.first.set (i, std::frexp (v.value (i), &exp));
-            result.second.set (i, exp);
+            fractions [i] = std::frexp (v.value (i), &exponents [i]);
+        }
+
+        return frexp_result <SIMDType> {
+            simd_type <fraction_type, traits_type::lanes> {fractions},
+            simd_type <int, traits_type::lanes> {exponents}
+        };
+    }
+
+    /*
+     * Attempts to compute ldexp/scalbn/scalbln as a direct integer add on
+     * the biased exponent field. Only valid when every lane of x is a
+     * normal number and the shifted exponent stays normal, so there is no
+     * overflow, underflow or subnormal handling to replicate; any other
+     * vector returns false and takes the per-lane libm path. Only enabled
+     * (through the trailing tag) for float and double multiplicand lanes
+     * with an integral exponent vector.
+     */
+    template <typename SIMDType, typename SIMDTypeExp>
+    simd_always_inline bool
+    scalbn_exponent_dispatch (SIMDType const & x, SIMDTypeExp const & exp,
+                              SIMDType & result, std::true_type) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using signed_type   = typename traits_type::signed_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+        using signed_bits   = simd_type <signed_type, traits_type::lanes>;
+
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr signed_type exponent_max =
+            std::is_same <value_type, float>::value ? 0xFF : 0x7FF;
+        static constexpr integral_type exponent_field_mask =
+            static_cast <integral_type> (exponent_max) << mantissa_bits;
+
+        auto const bits = x.template as <bits_type> ();
+        auto const exponent_field =
+            ((bits & bits_type {exponent_field_mask}) >>
+                integral_type {mantissa_bits}).template as <signed_bits> ();
+        auto const e = exp.template to <signed_bits> ();
+
+        /* the exponent bound also guards the sum against wrapping */
+        if (!all_of (
+                (exponent_field > signed_bits {signed_type {0}}) &&
+                (exponent_field < signed_bits {exponent_max}) &&
+                (e > signed_bits {static_cast <signed_type> (-exponent_max)})
+                    &&
+                (e < signed_bits {exponent_max}) &&
+                ((exponent_field + e) > signed_bits {signed_type {0}}) &&
+                ((exponent_field + e) < signed_bits {exponent_max})
+            ))
+        {
+            return false;
         }
-        return result;
+
+        auto const shifted_field =
+            (exponent_field + e).template as <bits_type> () <<
+                integral_type {mantissa_bits};
+
+        result = ((bits & ~bits_type {exponent_field_mask}) | shifted_field)
+            .template as <SIMDType> ();
+        return true;
+    }
+
+    template <typename SIMDType, typename SIMDTypeExp, typename SIMDTypeOut>
+    simd_always_inline bool
+    scalbn_exponent_dispatch (SIMDType const &, SIMDTypeExp const &,
+                              SIMDTypeOut &, std::false_type) noexcept
+    {
+        return false;
     }
 
     /*
@@ -9294,7 +9873,7 @@ namespace math
      * must be implicitly convertible to int.
      */
     template <typename SIMDTypeMultiplicand, typename SIMDTypeExp>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::ldexp (
             std::declval <
                 typename simd_traits <SIMDTypeMultiplicand>::value_type
@@ -9315,7 +9894,24 @@ namespace math
             "cannot apply ldexp function to SIMD vectors of different lenghts"
         );
 
-        return transform (
+        using result_type = simd_type <
+            decltype (std::ldexp (std::declval <m_value_type> (),
+                               std::declval <exp_value_type> ())),
+            m_traits_type::lanes
+        >;
+        using dispatch_eligible = std::integral_constant <
+            bool,
+            detail::iec559_value <m_value_type>::value &&
+            std::is_integral <exp_value_type>::value &&
+            std::is_same <SIMDTypeMultiplicand, result_type>::value
+        >;
+
+        result_type result {};
+        if (scalbn_exponent_dispatch (x, exp, result, dispatch_eligible {})) {
+            return result;
+        }
+
+        return batch_transform (
             [] (m_value_type const & m, exp_value_type const & e) noexcept
             {
                 return std::ldexp (m, e);
@@ -9325,45 +9921,55 @@ namespace math
     }
 
     /*
-     * Computes the decomposition of floating point values into integral and
-     * fractional parts for each lane of a SIMD vector. Returns a pair
-     * of SIMD vectors containing the integral and fractional parts,
-     * respectively.
+     * Result of math::modf; an aggregate of two SIMD vectors holding the
+     * fractional and integral parts of each lane. As with frexp_result, the
+     * named aggregate makes copy elision of the result reliable.
      */
     template <typename SIMDType>
-    std::pair <
+    struct modf_result
+    {
         simd_type <
             decltype (std::modf (
                 std::declval <typename simd_traits <SIMDType>::value_type> (),
                 std::declval <typename simd_traits <SIMDType>::value_type *> ()
             )),
             simd_traits <SIMDType>::lanes
-        >,
+        > fractional;
         simd_type <
             typename simd_traits <SIMDType>::value_type,
             simd_traits <SIMDType>::lanes
-        >
-    > modf (SIMDType const & v) noexcept
+        > integral;
+    };
+
+    /*
+     * Computes the decomposition of floating point values into integral and
+     * fractional parts for each lane of a SIMD vector. Returns SIMD vectors
+     * containing the fractional and integral parts in the members of the
+     * result with those names, respectively.
+     */
+    template <typename SIMDType>
+    simd_always_inline modf_result <SIMDType>
+    modf (SIMDType const & v) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
-        using result_type = std::pair <
-            simd_type <
-                decltype (std::modf (
-                    std::declval <value_type> (), std::declval <value_type *> ()
-                )),
-                traits_type::lanes
-            >,
-            simd_type <value_type, traits_type::lanes>
-        >;
+        using traits_type     = simd_traits <SIMDType>;
+        using value_type      = typename traits_type::value_type;
+        using fractional_type = decltype (
+            std::modf (
+                std::declval <value_type> (), std::declval <value_type *> ()
+            )
+        );
 
-        result_type result {};
+        /* the arrays are left uninitialized; every entry is written below */
+        std::array <fractional_type, traits_type::lanes> fractionals;
+        std::array <value_type, traits_type::lanes> integrals;
         for (std::size_t i = 0; i < traits_type::lanes; ++i) {
-            value_type integral_val;
-            result.first.set (i, std::modf (v.value (i), &integral_val));
-            result.second.set (i, integral_val);
+            fractionals [i] = std::modf (v.value (i), &integrals [i]);
         }
-        return result;
+
+        return modf_result <SIMDType> {
+            simd_type <fractional_type, traits_type::lanes> {fractionals},
+            simd_type <value_type, traits_type::lanes> {integrals}
+        };
     }
 
     /*
@@ -9372,7 +9978,7 @@ namespace math
      * vector must be convertible to int.
      */
     template <typename SIMDTypeMultiplicand, typename SIMDTypeExp>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::scalbn (
             std::declval <
                 typename simd_traits <SIMDTypeMultiplicand>::value_type
@@ -9393,7 +9999,24 @@ namespace math
             "cannot apply scalbn function to SIMD vectors of different lenghts"
         );
 
-        return transform (
+        using result_type = simd_type <
+            decltype (std::scalbn (std::declval <m_value_type> (),
+                               std::declval <exp_value_type> ())),
+            m_traits_type::lanes
+        >;
+        using dispatch_eligible = std::integral_constant <
+            bool,
+            detail::iec559_value <m_value_type>::value &&
+            std::is_integral <exp_value_type>::value &&
+            std::is_same <SIMDTypeMultiplicand, result_type>::value
+        >;
+
+        result_type result {};
+        if (scalbn_exponent_dispatch (x, exp, result, dispatch_eligible {})) {
+            return result;
+        }
+
+        return batch_transform (
             [] (m_value_type const & m, exp_value_type const & e) noexcept
             {
                 return std::scalbn (m, e);
@@ -9408,7 +10031,7 @@ namespace math
      * vector must be convertible to long.
      */
     template <typename SIMDTypeMultiplicand, typename SIMDTypeExp>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::scalbln (
             std::declval <
                 typename simd_traits <SIMDTypeMultiplicand>::value_type
@@ -9429,7 +10052,24 @@ namespace math
             "cannot apply scalbln function to SIMD vectors of different lenghts"
         );
 
-        return transform (
+        using result_type = simd_type <
+            decltype (std::scalbln (std::declval <m_value_type> (),
+                               std::declval <exp_value_type> ())),
+            m_traits_type::lanes
+        >;
+        using dispatch_eligible = std::integral_constant <
+            bool,
+            detail::iec559_value <m_value_type>::value &&
+            std::is_integral <exp_value_type>::value &&
+            std::is_same <SIMDTypeMultiplicand, result_type>::value
+        >;
+
+        result_type result {};
+        if (scalbn_exponent_dispatch (x, exp, result, dispatch_eligible {})) {
+            return result;
+        }
+
+        return batch_transform (
             [] (m_value_type const & m, exp_value_type const & e) noexcept
             {
                 return std::scalbln (m, e);
@@ -9439,62 +10079,388 @@ namespace math
     }
 
     /*
-     * Extracts the integral exponent of a floating point value for each lane
-     * of a SIMD vector.
+     * Exponent-field fast path for ilogb on IEEE-754 binary32/binary64
+     * vectors: the exponent of normal lanes is extracted with a shift, a
+     * mask and a bias subtraction, entirely in integer registers, and zero,
+     * infinity and NaN lanes blend in their constant results (FP_ILOGB0,
+     * INT_MAX and FP_ILOGBNAN) since each is a compile time constant. Only
+     * subnormal lanes, whose exponent needs the mantissa normalized first,
+     * fall back to the per-lane libm call.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <int, simd_traits <SIMDType>::lanes>
+    ilogb_impl (SIMDType const & v, std::true_type) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+        using result_type   = simd_type <int, traits_type::lanes>;
+
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type exponent_max =
+            std::is_same <value_type, float>::value ? 0xFF : 0x7FF;
+        static constexpr int exponent_bias =
+            std::is_same <value_type, float>::value ? 127 : 1023;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            exponent_max << mantissa_bits;
+
+        auto const abs_bits =
+            v.template as <bits_type> () & ~bits_type {sign_mask};
+        auto const exponent_field =
+            abs_bits >> integral_type {mantissa_bits};
+
+        auto const zero_lanes = abs_bits == bits_type {integral_type {0}};
+        auto const subnormal_lanes =
+            (exponent_field == bits_type {integral_type {0}}) && !zero_lanes;
+
+        /* only subnormal lanes need the mantissa renormalized by libm */
+        if (any_of (subnormal_lanes)) {
+            return batch_transform (
+                [] (value_type const & a) noexcept
+                {
+                    return std::ilogb (a);
+                },
+                v
+            );
+        }
+
+        auto const inf_lanes = abs_bits == bits_type {infinity_bits};
+        auto const nan_lanes = abs_bits > bits_type {infinity_bits};
+        auto const normal_lanes =
+            !(zero_lanes || inf_lanes || nan_lanes);
+
+        /* the classes partition the lanes, so the blend is a weighted sum */
+        return normal_lanes.template to <result_type> () *
+                   (exponent_field.template to <result_type> () -
+                        result_type {exponent_bias}) +
+               zero_lanes.template to <result_type> () *
+                   result_type {FP_ILOGB0} +
+               inf_lanes.template to <result_type> () *
+                   result_type {std::numeric_limits <int>::max ()} +
+               nan_lanes.template to <result_type> () *
+                   result_type {FP_ILOGBNAN};
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
         decltype (std::ilogb (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
         simd_traits <SIMDType>::lanes
-    > ilogb (SIMDType const & v) noexcept
+    > ilogb_impl (SIMDType const & v, std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::ilogb (a); }, v
         );
     }
 
     /*
-     * Extracts the floating point radix independent exponent of a floating
-     * point value, as a floating point result for each lane of a SIMD vector.
+     * Extracts the integral exponent of a floating point value for each lane
+     * of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::logb (
+    simd_always_inline simd_type <
+        decltype (std::ilogb (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
         simd_traits <SIMDType>::lanes
-    > logb (SIMDType const & v) noexcept
+    > ilogb (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
+
+        return ilogb_impl (v, ieee_dispatch {});
+    }
+
+    /*
+     * Exponent-field fast path for logb, mirroring ilogb_impl: the integer
+     * exponent of normal lanes converts straight to the floating point
+     * result, zero and infinity lanes blend in their IEEE constants (minus
+     * and plus infinity) and NaN lanes propagate their input bits. Only
+     * subnormal lanes take the per-lane libm call.
+     */
+    template <typename SIMDType>
+    simd_always_inline SIMDType logb_impl (
+        SIMDType const & v, std::true_type
+    ) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+        using signed_bits   = simd_type <
+            typename traits_type::signed_integral_type, traits_type::lanes
+        >;
+
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type exponent_max =
+            std::is_same <value_type, float>::value ? 0xFF : 0x7FF;
+        static constexpr typename traits_type::signed_integral_type
+            exponent_bias =
+                std::is_same <value_type, float>::value ? 127 : 1023;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            exponent_max << mantissa_bits;
+
+        auto const bits = v.template as <bits_type> ();
+        auto const abs_bits = bits & ~bits_type {sign_mask};
+        auto const exponent_field =
+            abs_bits >> integral_type {mantissa_bits};
+
+        auto const zero_lanes = abs_bits == bits_type {integral_type {0}};
+        auto const subnormal_lanes =
+            (exponent_field == bits_type {integral_type {0}}) && !zero_lanes;
+
+        /* only subnormal lanes need the mantissa renormalized by libm */
+        if (any_of (subnormal_lanes)) {
+            return batch_transform (
+                [] (value_type const & a) noexcept
+                {
+                    return std::logb (a);
+                },
+                v
+            );
+        }
+
+        auto const nan_lanes = abs_bits > bits_type {infinity_bits};
+        auto const normal_result =
+            (exponent_field.template as <signed_bits> () -
+             signed_bits {exponent_bias}).template to <SIMDType> ();
+
+        auto const zero_mask = bits_type {integral_type {0}} -
+            zero_lanes.template to <bits_type> ();
+        auto const inf_mask = bits_type {integral_type {0}} -
+            (abs_bits == bits_type {infinity_bits})
+                .template to <bits_type> ();
+        auto const nan_mask = bits_type {integral_type {0}} -
+            nan_lanes.template to <bits_type> ();
+        auto const normal_mask = ~(zero_mask | inf_mask | nan_mask);
+
+        /* logb (0) is -infinity, logb (+/-inf) is +infinity, NaN passes */
+        return ((normal_result.template as <bits_type> () & normal_mask) |
+                (bits_type {sign_mask | infinity_bits} & zero_mask) |
+                (bits_type {infinity_bits} & inf_mask) |
+                (bits & nan_mask)).template as <SIMDType> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
+        simd_traits <SIMDType>::lanes
+    > logb_impl (SIMDType const & v, std::false_type) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::logb (a); }, v
         );
     }
 
     /*
-     * Computes the next representable value from the floating point value from
-     * to the floating point value to for each lane of SIMD vectors.
+     * Extracts the floating point radix independent exponent of a floating
+     * point value, as a floating point result for each lane of a SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::nextafter (
-            std::declval <typename simd_traits <SIMDType>::value_type> (),
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
-    > nextafter (SIMDType const & from, SIMDType const & to) noexcept
+    > logb (SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename detail::transcendental_result <value_type>::type,
+            traits_type::lanes
+        >;
 
-        return transform (
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value &&
+            std::is_same <SIMDType, result_type>::value
+        >;
+
+        return logb_impl (v, ieee_dispatch {});
+    }
+
+    /*
+     * Maps the lanes of a float or double SIMD vector onto unsigned integer
+     * keys whose unsigned ordering matches the floating point ordering of
+     * the non-NaN values: the sign-magnitude bit pattern is converted to a
+     * biased two's complement key, with negative zero first collapsed onto
+     * positive zero so that equal values always map to equal keys. The quiet
+     * comparison predicates below compare these keys with integer operations
+     * only, which never touches the floating point environment; NaN lanes
+     * must be masked separately through unordered_lanes.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::unsigned_integral_type,
+        simd_traits <SIMDType>::lanes
+    > ordering_key (SIMDType const & v) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using signed_type   = typename traits_type::signed_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+        using signed_bits   = simd_type <signed_type, traits_type::lanes>;
+
+        static constexpr std::size_t value_bits = sizeof (value_type) * 8;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (value_bits - 1);
+
+        auto bits = v.template as <bits_type> ();
+
+        /* collapse negative zero onto positive zero */
+        auto const zero_lanes =
+            ((bits & ~bits_type {sign_mask}) == bits_type {integral_type {0}})
+                .template to <bits_type> ();
+        bits = bits & ~(zero_lanes << integral_type {value_bits - 1});
+
+        /* negative lanes map to ~bits, others are offset by the sign bit */
+        auto const sign_extended =
+            (bits.template as <signed_bits> () >>
+             signed_type {value_bits - 1}).template as <bits_type> ();
+
+        return bits ^ (sign_extended | bits_type {sign_mask});
+    }
+
+    /*
+     * Determines pairwise whether at least one of the lanes of two float or
+     * double SIMD vectors is NaN, entirely with integer bit tests.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > unordered_lanes (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            ~sign_mask & ~((integral_type {1} << mantissa_bits) - 1);
+
+        auto const abs_u =
+            u.template as <bits_type> () & ~bits_type {sign_mask};
+        auto const abs_v =
+            v.template as <bits_type> () & ~bits_type {sign_mask};
+
+        return (abs_u > bits_type {infinity_bits}) ||
+               (abs_v > bits_type {infinity_bits});
+    }
+
+    /*
+     * Integer-step fast path for nextafter on IEEE-754 binary32/binary64
+     * vectors: stepping to the adjacent representable value is a +/-1 on the
+     * ordering_key of each lane, which handles subnormal boundaries, the
+     * overflow to infinity and the step down from infinity uniformly. Lanes
+     * where from compares equal to to return to, lanes where from is zero
+     * step directly to the smallest subnormal carrying the sign of to, and
+     * unordered lanes propagate a NaN through from + to.
+     */
+    template <typename SIMDType>
+    simd_always_inline SIMDType nextafter_impl (
+        SIMDType const & from, SIMDType const & to, std::true_type
+    ) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+
+        static constexpr std::size_t value_bits = sizeof (value_type) * 8;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (value_bits - 1);
+
+        auto const key_from = ordering_key (from);
+        auto const key_to   = ordering_key (to);
+
+        auto const from_bits = from.template as <bits_type> ();
+        auto const to_bits   = to.template as <bits_type> ();
+
+        /* step the key towards to: +1 when to is above from, -1 otherwise */
+        auto const step_up = (key_to > key_from).template to <bits_type> ();
+        auto const stepped_key =
+            key_from + ((step_up << integral_type {1}) - bits_type {
+                integral_type {1}
+            });
+
+        /* invert the ordering_key mapping back to a bit pattern */
+        auto const stepped_sign =
+            (stepped_key & bits_type {sign_mask}) ==
+                bits_type {integral_type {0}};
+        auto const stepped_bits = stepped_key ^
+            (bits_type {sign_mask} |
+             (stepped_sign.template to <bits_type> () *
+              bits_type {static_cast <integral_type> (~sign_mask)}));
+
+        /* zero lanes step directly to the smallest subnormal towards to */
+        auto const from_zero_bits =
+            (to_bits & bits_type {sign_mask}) | bits_type {integral_type {1}};
+
+        auto const equal_mask = bits_type {integral_type {0}} -
+            (key_from == key_to).template to <bits_type> ();
+        auto const zero_mask  = bits_type {integral_type {0}} -
+            ((from_bits & ~bits_type {sign_mask}) ==
+                bits_type {integral_type {0}}).template to <bits_type> ();
+        auto const nan_mask   = bits_type {integral_type {0}} -
+            unordered_lanes (from, to).template to <bits_type> ();
+
+        auto const nan_bits = (from + to).template as <bits_type> ();
+
+        auto const result_bits =
+            (nan_bits & nan_mask) |
+            (~nan_mask &
+             ((to_bits & equal_mask) |
+              (~equal_mask &
+               ((from_zero_bits & zero_mask) |
+                (stepped_bits & ~zero_mask)))));
+
+        return result_bits.template as <SIMDType> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
+        simd_traits <SIMDType>::lanes
+    > nextafter_impl (
+        SIMDType const & from, SIMDType const & to, std::false_type
+    ) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+
+        return batch_transform (
             [] (value_type const & f, value_type const & t) noexcept
             {
                 return std::nextafter (f, t);
@@ -9508,7 +10474,38 @@ namespace math
      * to the floating point value to for each lane of SIMD vectors.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
+        simd_traits <SIMDType>::lanes
+    > nextafter (SIMDType const & from, SIMDType const & to) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename detail::transcendental_result <
+                value_type, value_type
+            >::type,
+            traits_type::lanes
+        >;
+
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value &&
+            std::is_same <SIMDType, result_type>::value
+        >;
+
+        return nextafter_impl (from, to, ieee_dispatch {});
+    }
+
+    /*
+     * Computes the next representable value from the floating point value from
+     * to the floating point value to for each lane of SIMD vectors.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
         decltype (std::nexttoward (
             std::declval <typename simd_traits <SIMDType>::value_type> (),
             std::declval <typename simd_traits <SIMDType>::value_type> ()
@@ -9519,7 +10516,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & f, value_type const & t) noexcept
             {
                 return std::nexttoward (f, t);
@@ -9529,23 +10526,45 @@ namespace math
     }
 
     /*
-     * Computes a floating point value with the magnitude of the first floating
-     * point value and the sign of the second floating point value for each lane
-     * of SIMD vectors.
+     * Bitwise implementation of copysign for lanes in one of the IEEE-754
+     * single or double formats: the sign bit of the second vector is blended
+     * onto the magnitude bits of the first with integer masking, one whole
+     * vector operation instead of a scalar library call per lane. Exact for
+     * every input, including zeros, infinities, and NaN payloads. The
+     * trailing tag selects the generic path for all other lane types.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::copysign (
-            std::declval <typename simd_traits <SIMDType>::value_type> (),
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
+    simd_always_inline SIMDType
+    copysign_impl (SIMDType const & mag, SIMDType const & sgn,
+                   std::true_type) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+
+        return ((mag.template as <bits_type> () & ~bits_type {sign_mask}) |
+                (sgn.template as <bits_type> () & bits_type {sign_mask}))
+            .template as <SIMDType> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
         simd_traits <SIMDType>::lanes
-    > copysign (SIMDType const & mag, SIMDType const & sgn) noexcept
+    > copysign_impl (SIMDType const & mag, SIMDType const & sgn,
+                     std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & m, value_type const & s) noexcept
             {
                 return std::copysign (m, s);
@@ -9554,13 +10573,44 @@ namespace math
         );
     }
 
+    /*
+     * Computes a floating point value with the magnitude of the first floating
+     * point value and the sign of the second floating point value for each lane
+     * of SIMD vectors.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
+        simd_traits <SIMDType>::lanes
+    > copysign (SIMDType const & mag, SIMDType const & sgn) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename detail::transcendental_result <
+                value_type, value_type
+            >::type,
+            traits_type::lanes
+        >;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value &&
+                std::is_same <SIMDType, result_type>::value
+        >;
+
+        return copysign_impl (mag, sgn, ieee_dispatch {});
+    }
+
     /*
      * Classifies the floating point value into one of: zero, subnormal, normal,
      * infinite, NaN, or an implementation defined category for each lane of a
      * SIMD vector.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         decltype (std::fpclassify (
             std::declval <typename simd_traits <SIMDType>::value_type> ()
         )),
@@ -9570,7 +10620,7 @@ namespace math
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a) noexcept { return std::fpclassify (a); },
             v
         );
@@ -9578,235 +10628,413 @@ namespace math
 
     /*
      * Determines if a floating point value is finite for each lane of a SIMD
-     * vector.
+     * vector. For lanes in one of the IEEE-754 single or double formats the
+     * test runs directly on the integer bit pattern -- the value is finite
+     * when its magnitude falls below the infinity pattern -- avoiding a
+     * scalar library call per lane; other lane types take the generic path
+     * through transform.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > isfinite (SIMDType const & v) noexcept
+    > isfinite_impl (SIMDType const & v, std::true_type) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
-        using result_type = simd_type <
-            typename simd_traits <SIMDType>::integral_type,
-            simd_traits <SIMDType>::lanes,
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using result_type   = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
             boolean_tag
         >;
+        using bits_type = simd_type <integral_type, traits_type::lanes>;
 
-        return transform (
-            [] (value_type const & a) noexcept { return std::isfinite (a); }, v
-        ).template to <result_type> ();
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            ~sign_mask & ~((integral_type {1} << mantissa_bits) - 1);
+
+        auto const abs_bits =
+            v.template as <bits_type> () & ~bits_type {sign_mask};
+
+        return (abs_bits < bits_type {infinity_bits})
+            .template to <result_type> ();
     }
 
-    /*
-     * Determines if a floating point value is infinite for each lane of a SIMD
-     * vector.
-     */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > isinf (SIMDType const & v) noexcept
+    > isfinite_impl (SIMDType const & v, std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
         using result_type = simd_type <
-            typename simd_traits <SIMDType>::integral_type,
-            simd_traits <SIMDType>::lanes,
+            typename traits_type::integral_type, traits_type::lanes,
             boolean_tag
         >;
 
-        return transform (
-            [] (value_type const & a) noexcept { return std::isinf (a); }, v
+        return batch_transform (
+            [] (value_type const & a) noexcept { return std::isfinite (a); }, v
         ).template to <result_type> ();
     }
 
-    /*
-     * Determines if a floating point value is not-a-number for each lane of a
-     * SIMD vector.
-     */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > isnan (SIMDType const & v) noexcept
+    > isfinite (SIMDType const & v) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
-        using result_type = simd_type <
-            typename simd_traits <SIMDType>::integral_type,
-            simd_traits <SIMDType>::lanes,
-            boolean_tag
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
         >;
 
-        return transform (
-            [] (value_type const & a) noexcept { return std::isnan (a); }, v
-        ).template to <result_type> ();
+        return isfinite_impl (v, ieee_dispatch {});
     }
 
     /*
-     * Determines if a floating point value is normal (neither zero, subnormal,
-     * infinite, nor NaN) for each lane of a SIMD vector.
+     * Determines if a floating point value is infinite for each lane of a
+     * SIMD vector. For lanes in one of the IEEE-754 single or double formats
+     * the magnitude bits are compared against the infinity pattern directly,
+     * avoiding a scalar library call per lane; other lane types take the
+     * generic path through transform.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > isnormal (SIMDType const & v) noexcept
+    > isinf_impl (SIMDType const & v, std::true_type) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
-        using result_type = simd_type <
-            typename simd_traits <SIMDType>::integral_type,
-            simd_traits <SIMDType>::lanes,
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using result_type   = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
             boolean_tag
         >;
+        using bits_type = simd_type <integral_type, traits_type::lanes>;
 
-        return transform (
-            [] (value_type const & a) noexcept { return std::isnormal (a); }, v
-        ).template to <result_type> ();
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            ~sign_mask & ~((integral_type {1} << mantissa_bits) - 1);
+
+        auto const abs_bits =
+            v.template as <bits_type> () & ~bits_type {sign_mask};
+
+        return (abs_bits == bits_type {infinity_bits})
+            .template to <result_type> ();
     }
 
-    /*
-     * Determines if a floating point value is negative for each lane of a SIMD
-     * vector.
-     */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > signbit (SIMDType const & v) noexcept
+    > isinf_impl (SIMDType const & v, std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
         using result_type = simd_type <
-            typename simd_traits <SIMDType>::integral_type,
-            simd_traits <SIMDType>::lanes,
+            typename traits_type::integral_type, traits_type::lanes,
             boolean_tag
         >;
 
-        return transform (
-            [] (value_type const & a) noexcept { return std::signbit (a); }, v
+        return batch_transform (
+            [] (value_type const & a) noexcept { return std::isinf (a); }, v
         ).template to <result_type> ();
     }
 
-    /*
-     * Determines the pairwise result of whether a floating point value is
-     * greater than another floating point value for each lane of SIMD vectors.
-     * This function does not set floating point exceptions.
-     */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > isgreater (SIMDType const & u, SIMDType const & v) noexcept
+    > isinf (SIMDType const & v) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
-        using result_type = simd_type <
-            typename simd_traits <SIMDType>::integral_type,
-            simd_traits <SIMDType>::lanes,
-            boolean_tag
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
         >;
 
-        return transform (
-            [] (value_type const & a, value_type const & b) noexcept
-            {
-                return std::isgreater (a, b);
-            },
-            u, v
-        ).template to <result_type> ();
+        return isinf_impl (v, ieee_dispatch {});
     }
 
     /*
-     * Determines the pairwise result of whether a floating point value is
-     * greater than or equal to another floating point value for each lane of
-     * SIMD vectors. This function does not set floating point exceptions.
+     * Determines if a floating point value is not-a-number for each lane of a
+     * SIMD vector. For lanes in one of the IEEE-754 single or double formats
+     * the test runs directly on the integer bit pattern -- a value is NaN
+     * exactly when its magnitude bits exceed the infinity pattern -- avoiding
+     * a scalar library call per lane; other lane types take the generic path
+     * through transform.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > isgreaterequal (SIMDType const & u, SIMDType const & v) noexcept
+    > isnan_impl (SIMDType const & v, std::true_type) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
-        using result_type = simd_type <
-            typename simd_traits <SIMDType>::integral_type,
-            simd_traits <SIMDType>::lanes,
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using result_type   = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
             boolean_tag
         >;
+        using bits_type = simd_type <integral_type, traits_type::lanes>;
 
-        return transform (
-            [] (value_type const & a, value_type const & b) noexcept
-            {
-                return std::isgreaterequal (a, b);
-            },
-            u, v
-        ).template to <result_type> ();
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            ~sign_mask & ~((integral_type {1} << mantissa_bits) - 1);
+
+        auto const abs_bits =
+            v.template as <bits_type> () & ~bits_type {sign_mask};
+
+        return (abs_bits > bits_type {infinity_bits})
+            .template to <result_type> ();
     }
 
-    /*
-     * Determines the pairwise result of whether a floating point value is
-     * less than another floating point value for each lane of SIMD vectors.
-     * This function does not set floating point exceptions.
-     */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > isless (SIMDType const & u, SIMDType const & v) noexcept
+    > isnan_impl (SIMDType const & v, std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
         using result_type = simd_type <
-            typename simd_traits <SIMDType>::integral_type,
-            simd_traits <SIMDType>::lanes,
+            typename traits_type::integral_type, traits_type::lanes,
             boolean_tag
         >;
 
-        return transform (
-            [] (value_type const & a, value_type const & b) noexcept
-            {
-                return std::isless (a, b);
-            },
-            u, v
+        return batch_transform (
+            [] (value_type const & a) noexcept { return std::isnan (a); }, v
         ).template to <result_type> ();
     }
 
-    /*
-     * Determines the pairwise result of whether a floating point value is
-     * less than or equal to another floating point value for each lane of
-     * SIMD vectors. This function does not set floating point exceptions.
-     */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > islessequal (SIMDType const & u, SIMDType const & v) noexcept
+    > isnan (SIMDType const & v) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
+
+        return isnan_impl (v, ieee_dispatch {});
+    }
+
+    /*
+     * Determines if a floating point value is normal (neither zero, subnormal,
+     * infinite, nor NaN) for each lane of a SIMD vector. For lanes in one of
+     * the IEEE-754 single or double formats the magnitude is checked against
+     * the window [smallest normal, infinity) with a single unsigned compare
+     * after rebasing -- zero and subnormal lanes wrap around -- avoiding a
+     * scalar library call per lane; other lane types take the generic path
+     * through transform.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isnormal_impl (SIMDType const & v, std::true_type) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using result_type   = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
+            boolean_tag
+        >;
+        using bits_type = simd_type <integral_type, traits_type::lanes>;
+
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            ~sign_mask & ~((integral_type {1} << mantissa_bits) - 1);
+
+        auto const abs_bits =
+            v.template as <bits_type> () & ~bits_type {sign_mask};
+
+        static constexpr integral_type min_normal_bits =
+            integral_type {1} << mantissa_bits;
+
+        return ((abs_bits - bits_type {min_normal_bits}) <
+                bits_type {infinity_bits - min_normal_bits})
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isnormal_impl (SIMDType const & v, std::false_type) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
+            boolean_tag
+        >;
+
+        return batch_transform (
+            [] (value_type const & a) noexcept { return std::isnormal (a); }, v
+        ).template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isnormal (SIMDType const & v) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
+
+        return isnormal_impl (v, ieee_dispatch {});
+    }
+
+    /*
+     * Determines if a floating point value is negative for each lane of a
+     * SIMD vector. For lanes in one of the IEEE-754 single or double formats
+     * the sign bit is tested directly on the integer bit pattern, which also
+     * reports the sign of zeros and NaNs without a scalar library call per
+     * lane; other lane types take the generic path through transform.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > signbit_impl (SIMDType const & v, std::true_type) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using result_type   = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
+            boolean_tag
+        >;
+        using bits_type = simd_type <integral_type, traits_type::lanes>;
+
+        static constexpr integral_type shift =
+            sizeof (typename traits_type::value_type) * 8 - 1;
+
+        /* a logical right shift of the unsigned bits drops the sign bit
+           into place as exactly the 0/1 truth values boolean vectors hold,
+           one instruction against the mask-and-compare pair */
+        return (v.template as <bits_type> () >> integral_type {shift})
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > signbit_impl (SIMDType const & v, std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
+            boolean_tag
+        >;
+
+        return batch_transform (
+            [] (value_type const & a) noexcept { return std::signbit (a); }, v
+        ).template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > signbit (SIMDType const & v) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
+
+        return signbit_impl (v, ieee_dispatch {});
+    }
+
+    /*
+     * Integer-key fast path for float and double lanes: evaluates
+     * u > v quietly by comparing ordering keys with NaN lanes
+     * masked out, so no floating point compare is issued and the floating
+     * point environment is untouched. The trailing tag selects the
+     * generic path for all other lane types.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isgreater_impl (SIMDType const & u, SIMDType const & v,
+        std::true_type) noexcept
+    {
         using result_type = simd_type <
             typename simd_traits <SIMDType>::integral_type,
             simd_traits <SIMDType>::lanes,
             boolean_tag
         >;
 
-        return transform (
+        return ((ordering_key (u) > ordering_key (v)) &&
+                !unordered_lanes (u, v))
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isgreater_impl (SIMDType const & u, SIMDType const & v,
+        std::false_type) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
+
+        return batch_transform (
             [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::islessequal (a, b);
+                return std::isgreater (a, b);
             },
             u, v
         ).template to <result_type> ();
@@ -9814,15 +11042,58 @@ namespace math
 
     /*
      * Determines the pairwise result of whether a floating point value is
-     * less than or greater than another floating point value for each lane of
-     * SIMD vectors. This function does not set floating point exceptions.
+     * greater than another floating point value for each lane of SIMD vectors.
+     * This function does not set floating point exceptions.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > islessgreater (SIMDType const & u, SIMDType const & v) noexcept
+    > isgreater (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
+
+        return isgreater_impl (u, v, ieee_dispatch {});
+    }
+
+    /*
+     * Integer-key fast path for float and double lanes: evaluates
+     * u >= v quietly by comparing ordering keys with NaN lanes
+     * masked out, so no floating point compare is issued and the floating
+     * point environment is untouched. The trailing tag selects the
+     * generic path for all other lane types.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isgreaterequal_impl (SIMDType const & u, SIMDType const & v,
+        std::true_type) noexcept
+    {
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
+
+        return ((ordering_key (u) >= ordering_key (v)) &&
+                !unordered_lanes (u, v))
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isgreaterequal_impl (SIMDType const & u, SIMDType const & v,
+        std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
@@ -9832,10 +11103,10 @@ namespace math
             boolean_tag
         >;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::islessgreater (a, b);
+                return std::isgreaterequal (a, b);
             },
             u, v
         ).template to <result_type> ();
@@ -9843,15 +11114,58 @@ namespace math
 
     /*
      * Determines the pairwise result of whether a floating point value is
-     * unordered with another floating point value for each lane of SIMD
-     * vectors. This function does not set floating point exceptions.
+     * greater than or equal to another floating point value for each lane of
+     * SIMD vectors. This function does not set floating point exceptions.
      */
     template <typename SIMDType>
-    simd_type <
+    simd_always_inline simd_type <
         typename simd_traits <SIMDType>::integral_type,
         simd_traits <SIMDType>::lanes,
         boolean_tag
-    > isunordered (SIMDType const & u, SIMDType const & v) noexcept
+    > isgreaterequal (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
+
+        return isgreaterequal_impl (u, v, ieee_dispatch {});
+    }
+
+    /*
+     * Integer-key fast path for float and double lanes: evaluates
+     * u < v quietly by comparing ordering keys with NaN lanes
+     * masked out, so no floating point compare is issued and the floating
+     * point environment is untouched. The trailing tag selects the
+     * generic path for all other lane types.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isless_impl (SIMDType const & u, SIMDType const & v,
+        std::true_type) noexcept
+    {
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
+
+        return ((ordering_key (u) < ordering_key (v)) &&
+                !unordered_lanes (u, v))
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isless_impl (SIMDType const & u, SIMDType const & v,
+        std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
@@ -9861,820 +11175,1212 @@ namespace math
             boolean_tag
         >;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::isunordered (a, b);
+                return std::isless (a, b);
             },
             u, v
         ).template to <result_type> ();
     }
 
     /*
-     * Computes the pairwise fmod of two SIMD vectors.
+     * Determines the pairwise result of whether a floating point value is
+     * less than another floating point value for each lane of SIMD vectors.
+     * This function does not set floating point exceptions.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::fmod (
-            std::declval <typename simd_traits <SIMDType>::value_type> (),
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
-        simd_traits <SIMDType>::lanes
-    > fmod (SIMDType const & u, SIMDType const & v) noexcept
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isless (SIMDType const & u, SIMDType const & v) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
 
-        return transform (
-            [] (value_type const & a, value_type const & b) noexcept
-            {
-                return std::fmod (a, b);
-            },
-            u, v
-        );
+        return isless_impl (u, v, ieee_dispatch {});
     }
 
     /*
-     * Computes the pairwise remainder of two SIMD vectors.
+     * Integer-key fast path for float and double lanes: evaluates
+     * u <= v quietly by comparing ordering keys with NaN lanes
+     * masked out, so no floating point compare is issued and the floating
+     * point environment is untouched. The trailing tag selects the
+     * generic path for all other lane types.
      */
     template <typename SIMDType>
-    simd_type <
-        decltype (std::remainder (
-            std::declval <typename simd_traits <SIMDType>::value_type> (),
-            std::declval <typename simd_traits <SIMDType>::value_type> ()
-        )),
-        simd_traits <SIMDType>::lanes
-    > remainder (SIMDType const & u, SIMDType const & v) noexcept
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > islessequal_impl (SIMDType const & u, SIMDType const & v,
+        std::true_type) noexcept
+    {
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
+
+        return ((ordering_key (u) <= ordering_key (v)) &&
+                !unordered_lanes (u, v))
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > islessequal_impl (SIMDType const & u, SIMDType const & v,
+        std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
         using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
 
-        return transform (
+        return batch_transform (
             [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::remainder (a, b);
+                return std::islessequal (a, b);
             },
             u, v
-        );
+        ).template to <result_type> ();
     }
 
     /*
-     * Computes the pairwise remainder of two SIMD vectors as well as the sign
-     * and at least the three last bits of the division, which is stored in the
-     * second SIMD vector of the result pair.
+     * Determines the pairwise result of whether a floating point value is
+     * less than or equal to another floating point value for each lane of
+     * SIMD vectors. This function does not set floating point exceptions.
      */
     template <typename SIMDType>
-    std::pair <
-        simd_type <
-            decltype (std::remquo (
-                std::declval <typename simd_traits <SIMDType>::value_type> (),
-                std::declval <typename simd_traits <SIMDType>::value_type> ()
-            )),
-            simd_traits <SIMDType>::lanes
-        >,
-        simd_type <int, simd_traits <SIMDType>::lanes>
-    > remquo (SIMDType const & u, SIMDType const & v) noexcept
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > islessequal (SIMDType const & u, SIMDType const & v) noexcept
     {
-        using traits_type = simd_traits <SIMDType>;
-        using value_type  = typename traits_type::value_type;
-        using result_type = std::pair <
-            simd_type <
-                decltype (std::remquo (
-                    std::declval <value_type> (), std::declval <value_type> ()
-                )),
-                traits_type::lanes
-            >,
-            simd_type <int, traits_type::lanes>
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
         >;
 
-        result_type result {};
-        for (std::size_t i = 0; i < traits_type::lanes; ++i) {
-            int quo;
-            result.first.set (
-                i, std::remquo (u.value (i), v.value (i), &quo)
-            );
-            result.second.set (i, quo);
-        }
-        return result;
+        return islessequal_impl (u, v, ieee_dispatch {});
     }
 
     /*
-     * Computes the fused multiply and add operation of three SIMD vectors,
-     * in the form (u * v) + w.
+     * Integer-key fast path for float and double lanes: evaluates
+     * u < v or u > v quietly by comparing ordering keys with NaN lanes
+     * masked out, so no floating point compare is issued and the floating
+     * point environment is untouched. The trailing tag selects the
+     * generic path for all other lane types.
      */
-    template <typename SIMDType1, typename SIMDType2, typename SIMDType3>
-    simd_type <
-        decltype (std::fma (
-            std::declval <typename simd_traits <SIMDType1>::value_type> (),
-            std::declval <typename simd_traits <SIMDType2>::value_type> (),
-            std::declval <typename simd_traits <SIMDType3>::value_type> ()
-        )),
-        simd_traits <SIMDType1>::lanes
-    > fma (SIMDType1 const & u, SIMDType2 const & v, SIMDType3 const & w)
-        noexcept
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > islessgreater_impl (SIMDType const & u, SIMDType const & v,
+        std::true_type) noexcept
     {
-        using traits_type1 = simd_traits <SIMDType1>;
-        using value_type1  = typename traits_type1::value_type;
-
-        using traits_type2 = simd_traits <SIMDType2>;
-        using value_type2  = typename traits_type2::value_type;
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
 
-        using traits_type3 = simd_traits <SIMDType3>;
-        using value_type3  = typename traits_type3::value_type;
+        return ((ordering_key (u) != ordering_key (v)) &&
+                !unordered_lanes (u, v))
+            .template to <result_type> ();
+    }
 
-        static_assert (
-            traits_type1::lanes == traits_type2::lanes &&
-            traits_type1::lanes == traits_type3::lanes,
-            "cannot compute fma across SIMD vectors of different lengths"
-        );
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > islessgreater_impl (SIMDType const & u, SIMDType const & v,
+        std::false_type) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
 
-        return transform (
-            [] (value_type1 const & a,
-                value_type2 const & b,
-                value_type3 const & c) noexcept
+        return batch_transform (
+            [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::fma (a, b, c);
+                return std::islessgreater (a, b);
             },
-            u, v, w
-        );
+            u, v
+        ).template to <result_type> ();
     }
 
-#if __cplusplus > 201402L
     /*
-     * Computes the pairwise gcd of two SIMD vectors.
+     * Determines the pairwise result of whether a floating point value is
+     * less than or greater than another floating point value for each lane of
+     * SIMD vectors. This function does not set floating point exceptions.
      */
-    template <typename SIMDType1, typename SIMDType2>
-    constexpr simd_type <
-        decltype (std::gcd (
-            std::declval <typename simd_traits <SIMDType1>::value_type> (),
-            std::declval <typename simd_traits <SIMDType2>::value_type> ()
-        )),
-        simd_traits <SIMDType1>::lanes
-    > gcd (SIMDType1 const & u, SIMDType2 const & v) noexcept
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > islessgreater (SIMDType const & u, SIMDType const & v) noexcept
     {
-        using traits_type1 = simd_traits <SIMDType1>;
-        using value_type1  = typename traits_type1::value_type;
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
 
-        using traits_type2 = simd_traits <SIMDType2>;
-        using value_type2  = typename traits_type2::value_type;
+        return islessgreater_impl (u, v, ieee_dispatch {});
+    }
 
-        static_assert (
-            traits_type1::lanes == traits_type2::lanes,
-            "cannot compute gcd across SIMD vectors of different length"
-        );
+    /*
+     * Integer-key fast path for float and double lanes: reports whether
+     * either input is NaN, with pure bit tests and no floating point
+     * environment interaction. The trailing tag selects the generic path
+     * for all other lane types.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isunordered_impl (SIMDType const & u, SIMDType const & v,
+        std::true_type) noexcept
+    {
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
 
-        return transform (
-            [] (value_type1 const & a, value_type2 const & b) constexpr noexcept
+        return unordered_lanes (u, v)
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isunordered_impl (SIMDType const & u, SIMDType const & v,
+        std::false_type) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename simd_traits <SIMDType>::integral_type,
+            simd_traits <SIMDType>::lanes,
+            boolean_tag
+        >;
+
+        return batch_transform (
+            [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::gcd (a, b);
+                return std::isunordered (a, b);
             },
             u, v
-        );
+        ).template to <result_type> ();
     }
 
     /*
-     * Computes the pairwise lcm of two SIMD vectors.
+     * Determines the pairwise result of whether a floating point value is
+     * unordered with another floating point value for each lane of SIMD
+     * vectors. This function does not set floating point exceptions.
      */
-    template <typename SIMDType1, typename SIMDType2>
-    constexpr simd_type <
-        decltype (std::lcm (
-            std::declval <typename simd_traits <SIMDType1>::value_type> (),
-            std::declval <typename simd_traits <SIMDType2>::value_type> ()
-        )),
-        simd_traits <SIMDType1>::lanes
-    > lcm (SIMDType1 const & u, SIMDType2 const & v) noexcept
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > isunordered (SIMDType const & u, SIMDType const & v) noexcept
     {
-        using traits_type1 = simd_traits <SIMDType1>;
-        using value_type1  = typename traits_type1::value_type;
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
 
-        using traits_type2 = simd_traits <SIMDType2>;
-        using value_type2  = typename traits_type2::value_type;
+        return isunordered_impl (u, v, ieee_dispatch {});
+    }
 
-        static_assert (
-            traits_type1::lanes == traits_type2::lanes,
-            "cannot compute lcm across SIMD vectors of different length"
-        );
+    /*
+     * Fused guard predicates. Code guarding a computation with
+     * isfinite (u) && isgreater (u, v) (or the isless form) walks both
+     * vectors once per predicate and materializes two intermediate boolean
+     * vectors; for data streamed from memory that doubles the bytes moved
+     * for what is a single combined lane test. The fused forms below
+     * evaluate the whole guard in one pass: on IEEE lanes the finiteness
+     * test, the NaN exclusion and the ordered comparison all come from one
+     * reading of each vector's bits, and the scalar fallback folds both
+     * standard predicates into a single transform lambda. Like the quiet
+     * comparisons they never set floating point exceptions.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > finite_greater_impl (SIMDType const & u, SIMDType const & v,
+                           std::true_type) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+        using result_type   = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
+            boolean_tag
+        >;
 
-        return transform (
-            [] (value_type1 const & a, value_type2 const & b) constexpr noexcept
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            ~sign_mask & ~((integral_type {1} << mantissa_bits) - 1);
+
+        auto const abs_u =
+            u.template as <bits_type> () & ~bits_type {sign_mask};
+        auto const abs_v =
+            v.template as <bits_type> () & ~bits_type {sign_mask};
+
+        /* u finite, v not NaN, and the integer keys strictly ordered */
+        return ((abs_u < bits_type {infinity_bits}) &&
+                !(abs_v > bits_type {infinity_bits}) &&
+                (ordering_key (u) > ordering_key (v)))
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > finite_greater_impl (SIMDType const & u, SIMDType const & v,
+                           std::false_type) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
+            boolean_tag
+        >;
+
+        return batch_transform (
+            [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::lcm (a, b);
+                return std::isfinite (a) && std::isgreater (a, b);
             },
             u, v
-        );
+        ).template to <result_type> ();
     }
 
     /*
-     * Computes the clamped value for each lane of a SIMD vector.
+     * Determines pairwise whether each lane of u is finite and quietly
+     * compares greater than the matching lane of v, in a single pass over
+     * both vectors. This function does not set floating point exceptions.
      */
     template <typename SIMDType>
-    constexpr SIMDType
-        clamp (SIMDType const & u, SIMDType const & lo, SIMDType const & hi)
-        noexcept
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > finite_greater (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
+
+        return finite_greater_impl (u, v, ieee_dispatch {});
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > finite_less_impl (SIMDType const & u, SIMDType const & v,
+                        std::true_type) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using bits_type     = simd_type <integral_type, traits_type::lanes>;
+        using result_type   = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
+            boolean_tag
+        >;
+
+        static constexpr std::size_t mantissa_bits =
+            std::is_same <value_type, float>::value ? 23 : 52;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        static constexpr integral_type infinity_bits =
+            ~sign_mask & ~((integral_type {1} << mantissa_bits) - 1);
+
+        auto const abs_u =
+            u.template as <bits_type> () & ~bits_type {sign_mask};
+        auto const abs_v =
+            v.template as <bits_type> () & ~bits_type {sign_mask};
+
+        /* u finite, v not NaN, and the integer keys strictly ordered */
+        return ((abs_u < bits_type {infinity_bits}) &&
+                !(abs_v > bits_type {infinity_bits}) &&
+                (ordering_key (u) < ordering_key (v)))
+            .template to <result_type> ();
+    }
+
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > finite_less_impl (SIMDType const & u, SIMDType const & v,
+                        std::false_type) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
-        uisng value_type  = typename traits_type::value_type;
+        using value_type  = typename traits_type::value_type;
+        using result_type = simd_type <
+            typename traits_type::integral_type, traits_type::lanes,
+            boolean_tag
+        >;
 
-        return transform (
-            [] (value_type const & val,
-                value_type const & l,
-                value_type const & h) constexpr noexcept
+        return batch_transform (
+            [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::clamp (val, l, h);
+                return std::isfinite (a) && std::isless (a, b);
             },
-            u, lo, hi
-        );
+            u, v
+        ).template to <result_type> ();
     }
 
     /*
-     * Computes the clamped value for each lane of a SIMD vector using the
-     * provided comparison function.
+     * Determines pairwise whether each lane of u is finite and quietly
+     * compares less than the matching lane of v, in a single pass over both
+     * vectors. This function does not set floating point exceptions.
      */
-    template <typename SIMDType, typename Compare>
-    constexpr SIMDType clamp (SIMDType const & u,
-                              SIMDType const & lo,
-                              SIMDType const & hi,
-                              Compare && comp)
-        noexcept
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename simd_traits <SIMDType>::integral_type,
+        simd_traits <SIMDType>::lanes,
+        boolean_tag
+    > finite_less (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using ieee_dispatch = std::integral_constant <
+            bool,
+            detail::iec559_value <value_type>::value
+        >;
+
+        return finite_less_impl (u, v, ieee_dispatch {});
+    }
+
+    /*
+     * Computes the pairwise fmod of two SIMD vectors.
+     */
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
+        simd_traits <SIMDType>::lanes
+    > fmod (SIMDType const & u, SIMDType const & v) noexcept
     {
         using traits_type = simd_traits <SIMDType>;
-        uisng value_type  = typename traits_type::value_type;
+        using value_type  = typename traits_type::value_type;
 
-        return transform (
-            [c = std::forward <Compare> (comp)] (value_type const & val,
-                                                 value_type const & l,
-                                                 value_type const & h)
-                constexpr noexcept
+        return batch_transform (
+            [] (value_type const & a, value_type const & b) noexcept
             {
-                return std::clamp (val, l, h, c);
+                return std::fmod (a, b);
             },
-            u, lo, hi
+            u, v
         );
     }
-#endif
-}   // namespace math
 
     /*
-     * These are the default provided typedefs for SIMD vector types, they cover
-     * the normal range of vector types available on targets with 64 bit,
-     * 128 bit, 256 bit, and/or 512 bit support. Clang and GCC will synthesize
-     * instructions when target hardware support is not available, so we
-     * provide all common SIMD vector types. Target specific typedefs are
-     * provided below.
+     * Computes the pairwise remainder of two SIMD vectors.
      */
-inline namespace common
-{
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+    template <typename SIMDType>
+    simd_always_inline simd_type <
+        typename detail::transcendental_result <
+            typename simd_traits <SIMDType>::value_type,
+            typename simd_traits <SIMDType>::value_type
+        >::type,
+        simd_traits <SIMDType>::lanes
+    > remainder (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
 
-    /* 16 8-bit lanes */
-    using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
-    using int8x16_t  = simd_type <std::int8_t, 16>;
-    using uint8x16_t = simd_type <std::uint8_t, 16>;
+        return batch_transform (
+            [] (value_type const & a, value_type const & b) noexcept
+            {
+                return std::remainder (a, b);
+            },
+            u, v
+        );
+    }
 
-    /* 32 8-bit lanes */
-    using bool8x32_t = simd_type <std::int8_t, 32, boolean_tag>;
-    using int8x32_t  = simd_type <std::int8_t, 32>;
-    using uint8x32_t = simd_type <std::uint8_t, 32>;
+    /*
+     * Result of math::remquo; an aggregate of two SIMD vectors holding the
+     * remainders and the signed low quotient bits of each lane. As with
+     * frexp_result, the named aggregate makes copy elision of the result
+     * reliable, and callers consuming only one member let the compiler
+     * discard the computation of the other where it is dead.
+     */
+    template <typename SIMDType>
+    struct remquo_result
+    {
+        simd_type <
+            decltype (std::remquo (
+                std::declval <typename simd_traits <SIMDType>::value_type> (),
+                std::declval <typename simd_traits <SIMDType>::value_type> (),
+                std::declval <int *> ()
+            )),
+            simd_traits <SIMDType>::lanes
+        > remainder;
+        simd_type <int, simd_traits <SIMDType>::lanes> quotient;
+    };
 
-    /* 64 8-bit lanes */
-    using bool8x64_t = simd_type <std::int8_t, 64, boolean_tag>;
-    using int8x64_t  = simd_type <std::int8_t, 64>;
-    using uint8x64_t = simd_type <std::uint8_t, 64>;
+    /*
+     * Computes the pairwise remainder of two SIMD vectors as well as the sign
+     * and at least the three last bits of the division, returning SIMD
+     * vectors with the above values in the remainder and quotient members of
+     * the result, respectively.
+     */
+    template <typename SIMDType>
+    simd_always_inline remquo_result <SIMDType>
+    remquo (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+        using remainder_type = decltype (
+            std::remquo (
+                std::declval <value_type> (), std::declval <value_type> (),
+                std::declval <int *> ()
+            )
+        );
 
-    /* 8 16-bit lanes */
-    using bool16x8_t = simd_type <std::int16_t, 8, boolean_tag>;
-    using int16x8_t  = simd_type <std::int16_t, 8>;
-    using uint16x8_t = simd_type <std::uint16_t, 8>;
+        /* the arrays are left uninitialized; every entry is written below */
+        std::array <remainder_type, traits_type::lanes> remainders;
+        std::array <int, traits_type::lanes> quotients;
+        for (std::size_t i = 0; i < traits_type::lanes; ++i) {
+            remainders [i] = std::remquo (
+                u.value (i), v.value (i), &quotients [i]
+            );
+        }
 
-    /* 16 16-bit lanes */
-    using bool16x16_t = simd_type <std::int16_t, 16, boolean_tag>;
-    using int16x16_t  = simd_type <std::int16_t, 16>;
-    using uint16x16_t = simd_type <std::uint16_t, 16>;
+        return remquo_result <SIMDType> {
+            simd_type <remainder_type, traits_type::lanes> {remainders},
+            simd_type <int, traits_type::lanes> {quotients}
+        };
+    }
 
-    /* 32 16-bit lanes */
-    using bool16x32_t = simd_type <std::int16_t, 32, boolean_tag>;
-    using int16x32_t  = simd_type <std::int16_t, 32>;
-    using uint16x32_t = simd_type <std::uint16_t, 32>;
+    /*
+     * Computes the fused multiply and add operation of three SIMD vectors,
+     * in the form (u * v) + w, rounded once.
+     *
+     * The per-lane std::fma below is intentional and is not a missed
+     * vectorization: when the target provides fused multiply-add hardware
+     * (e.g. compiled with -mfma or -march covering FMA3, or on AArch64)
+     * both supported compilers inline each lane to the hardware instruction
+     * and then fold the unrolled lanes back into a single whole-vector fused
+     * instruction (verified: one vfmadd132ps for float lanes under -mfma).
+     * Writing (u * v) + w on the vector types instead would round twice
+     * wherever contraction is unavailable or disabled, silently changing
+     * results between targets.
+     */
+    template <typename SIMDType1, typename SIMDType2, typename SIMDType3>
+    simd_always_inline simd_type <
+        decltype (std::fma (
+            std::declval <typename simd_traits <SIMDType1>::value_type> (),
+            std::declval <typename simd_traits <SIMDType2>::value_type> (),
+            std::declval <typename simd_traits <SIMDType3>::value_type> ()
+        )),
+        simd_traits <SIMDType1>::lanes
+    > fma (SIMDType1 const & u, SIMDType2 const & v, SIMDType3 const & w)
+        noexcept
+    {
+        using traits_type1 = simd_traits <SIMDType1>;
+        using value_type1  = typename traits_type1::value_type;
 
-    /* 2 32-bit lanes */
-    using bool32x2_t          = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t           = simd_type <std::int32_t, 2>;
-    using uint32x2_t          = simd_type <std::uint32_t, 2>;
-    using float32x2_t         = simd_type <float, 2>;
-    using complex_float32x2_t = simd_type <float, 2, complex_tag>;
+        using traits_type2 = simd_traits <SIMDType2>;
+        using value_type2  = typename traits_type2::value_type;
 
-    /* 4 32-bit lanes */
-    using bool32x4_t          = simd_type <std::int32_t, 4, boolean_tag>;
-    using int32x4_t           = simd_type <std::int32_t, 4>;
-    using uint32x4_t          = simd_type <std::uint32_t, 4>;
-    using float32x4_t         = simd_type <float, 4>;
-    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
+        using traits_type3 = simd_traits <SIMDType3>;
+        using value_type3  = typename traits_type3::value_type;
 
-    /* 8 32-bit lanes */
-    using bool32x8_t          = simd_type <std::int32_t, 8, boolean_tag>;
-    using int32x8_t           = simd_type <std::int32_t, 8>;
-    using uint32x8_t          = simd_type <std::uint32_t, 8>;
-    using float32x8_t         = simd_type <float, 8>;
-    using complex_float32x8_t = simd_type <float, 8, complex_tag>;
+        static_assert (
+            traits_type1::lanes == traits_type2::lanes &&
+            traits_type1::lanes == traits_type3::lanes,
+            "cannot compute fma across SIMD vectors of different lengths"
+        );
 
-    /* 16 32-bit lanes */
-    using bool32x16_t          = simd_type <std::int32_t, 16, boolean_tag>;
-    using int32x16_t           = simd_type <std::int32_t, 16>;
-    using uint32x16_t          = simd_type <std::uint32_t, 16>;
-    using float32x16_t         = simd_type <float, 16>;
-    using complex_float32x16_t = simd_type <float, 16, complex_tag>;
+        return batch_transform (
+            [] (value_type1 const & a,
+                value_type2 const & b,
+                value_type3 const & c) noexcept
+            {
+                return std::fma (a, b, c);
+            },
+            u, v, w
+        );
+    }
 
-    /* 1 64-bit lane */
-    using bool64x1_t          = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t           = simd_type <std::int64_t, 1>;
-    using uint64x1_t          = simd_type <std::uint64_t, 1>;
-    using float64x1_t         = simd_type <double, 1>;
-    using complex_float64x1_t = simd_type <double, 1, complex_tag>;
+#if __cplusplus > 201402L
+    /*
+     * Magnitude of an integral value as the matching unsigned type, with
+     * the usual two's complement negation so the minimum signed value is
+     * handled without overflow. The signedness tag keeps the comparison
+     * against zero out of the unsigned instantiations.
+     */
+    template <typename IntegralType>
+    constexpr typename std::make_unsigned <IntegralType>::type
+    unsigned_magnitude_impl (IntegralType v, std::true_type) noexcept
+    {
+        using unsigned_type = typename std::make_unsigned <IntegralType>::type;
 
-    /* 2 64-bit lanes */
-    using bool64x2_t          = simd_type <std::int64_t, 2, boolean_tag>;
-    using int64x2_t           = simd_type <std::int64_t, 2>;
-    using uint64x2_t          = simd_type <std::uint64_t, 2>;
-    using float64x2_t         = simd_type <double, 2>;
-    using complex_float64x2_t = simd_type <double, 2, complex_tag>;
+        return v < IntegralType {0}
+            ? unsigned_type {0} - static_cast <unsigned_type> (v)
+            : static_cast <unsigned_type> (v);
+    }
 
-    /* 4 64-bit lanes */
-    using bool64x4_t          = simd_type <std::int64_t, 4, boolean_tag>;
-    using int64x4_t           = simd_type <std::int64_t, 4>;
-    using uint64x4_t          = simd_type <std::uint64_t, 4>;
-    using float64x4_t         = simd_type <double, 4>;
-    using complex_float64x4_t = simd_type <double, 4, complex_tag>;
+    template <typename IntegralType>
+    constexpr typename std::make_unsigned <IntegralType>::type
+    unsigned_magnitude_impl (IntegralType v, std::false_type) noexcept
+    {
+        return static_cast <typename std::make_unsigned <IntegralType>::type> (
+            v
+        );
+    }
 
-    /* 8 64-bit lanes */
-    using bool64x8_t          = simd_type <std::int64_t, 8, boolean_tag>;
-    using int64x8_t           = simd_type <std::int64_t, 8>;
-    using uint64x8_t          = simd_type <std::uint64_t, 8>;
-    using float64x8_t         = simd_type <double, 8>;
-    using complex_float64x8_t = simd_type <float, 8, complex_tag>;
+    template <typename IntegralType>
+    constexpr typename std::make_unsigned <IntegralType>::type
+    unsigned_magnitude (IntegralType v) noexcept
+    {
+        return unsigned_magnitude_impl (
+            v, std::integral_constant <
+                bool, std::is_signed <IntegralType>::value
+            > {}
+        );
+    }
 
     /*
-     * long double specializations; may be 80-bit (x87), 128-bit,
-     * or even a synonym for double floating point types depending
-     * on the implementation.
+     * Stein's binary gcd on unsigned operands: the shared and per-operand
+     * factors of two are stripped with count-trailing-zeros instead of
+     * iterated division, leaving only subtractions in the loop. This is
+     * considerably cheaper than the Euclidean modulo loop the standard
+     * library uses, and the building block for the gcd and lcm wrappers
+     * below.
      */
+    template <typename UnsignedType>
+    constexpr UnsignedType
+    binary_gcd (UnsignedType x, UnsignedType y) noexcept
+    {
+        if (x == UnsignedType {0}) {
+            return y;
+        }
+        if (y == UnsignedType {0}) {
+            return x;
+        }
 
-    /* long double x 2 */
-    using long_doublex2_t         = simd_type <long double, 2>;
-    using complex_long_doublex2_t = simd_type <long double, 2, complex_tag>;
+        int const shared_twos = __builtin_ctzll (
+            static_cast <unsigned long long> (x | y)
+        );
 
-    /* long double x 4 */
-    using long_doublex4_t         = simd_type <long double, 4>;
-    using complex_long_doublex4_t = simd_type <long double, 4, complex_tag>;
+        x >>= __builtin_ctzll (static_cast <unsigned long long> (x));
+        while (y != UnsignedType {0}) {
+            y >>= __builtin_ctzll (static_cast <unsigned long long> (y));
+            if (x > y) {
+                UnsignedType const t = x;
+                x = y;
+                y = t;
+            }
+            y = static_cast <UnsignedType> (y - x);
+        }
 
-    /* Guaranteed 128-bit integer SIMD vectors */
-    /* 1 128-bit lane */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
-#endif
+        return static_cast <UnsignedType> (x << shared_twos);
+    }
 
-    /* 2 128-bit lanes */
-#if SIMD_HEADER_CLANG
-    using bool128x2_t = simd_type <__int128_t, 2, boolean_tag>;
-    using int128x2_t  = simd_type <__int128_t, 2>;
-    using uint128x2_t = simd_type <__uint128_t, 2>;
-#elif SIMD_HEADER_GNUG
-    using bool128x2_t = simd_type <__int128, 2, boolean_tag>;
-    using int128x2_t  = simd_type <__int128, 2>;
-    using uint128x2_t = simd_type <unsigned __int128, 2>;
-#endif
+    /*
+     * Computes the pairwise gcd of two SIMD vectors.
+     */
+    template <typename SIMDType1, typename SIMDType2>
+    simd_always_inline constexpr simd_type <
+        decltype (std::gcd (
+            std::declval <typename simd_traits <SIMDType1>::value_type> (),
+            std::declval <typename simd_traits <SIMDType2>::value_type> ()
+        )),
+        simd_traits <SIMDType1>::lanes
+    > gcd (SIMDType1 const & u, SIMDType2 const & v) noexcept
+    {
+        using traits_type1 = simd_traits <SIMDType1>;
+        using value_type1  = typename traits_type1::value_type;
 
-    /* 4 128-bit lanes */
-#if SIMD_HEADER_CLANG
-    using bool128x4_t = simd_type <__int128_t, 4, boolean_tag>;
-    using int128x4_t  = simd_type <__int128_t, 4>;
-    using uint128x4_t = simd_type <__uint128_t, 4>;
-#elif SIMD_HEADER_GNUG
-    using bool128x4_t = simd_type <__int128, 4, boolean_tag>;
-    using int128x4_t  = simd_type <__int128, 4>;
-    using uint128x4_t = simd_type <unsigned __int128, 4>;
+        using traits_type2 = simd_traits <SIMDType2>;
+        using value_type2  = typename traits_type2::value_type;
+
+        static_assert (
+            traits_type1::lanes == traits_type2::lanes,
+            "cannot compute gcd across SIMD vectors of different length"
+        );
+
+        return transform (
+            [] (value_type1 const & a, value_type2 const & b) constexpr noexcept
+            {
+                using result_type = decltype (std::gcd (a, b));
+
+                return static_cast <result_type> (
+                    binary_gcd (
+                        unsigned_magnitude (static_cast <result_type> (a)),
+                        unsigned_magnitude (static_cast <result_type> (b))
+                    )
+                );
+            },
+            u, v
+        );
+    }
+
+    /*
+     * Computes the pairwise lcm of two SIMD vectors.
+     */
+    template <typename SIMDType1, typename SIMDType2>
+    simd_always_inline constexpr simd_type <
+        decltype (std::lcm (
+            std::declval <typename simd_traits <SIMDType1>::value_type> (),
+            std::declval <typename simd_traits <SIMDType2>::value_type> ()
+        )),
+        simd_traits <SIMDType1>::lanes
+    > lcm (SIMDType1 const & u, SIMDType2 const & v) noexcept
+    {
+        using traits_type1 = simd_traits <SIMDType1>;
+        using value_type1  = typename traits_type1::value_type;
+
+        using traits_type2 = simd_traits <SIMDType2>;
+        using value_type2  = typename traits_type2::value_type;
+
+        static_assert (
+            traits_type1::lanes == traits_type2::lanes,
+            "cannot compute lcm across SIMD vectors of different length"
+        );
+
+        return transform (
+            [] (value_type1 const & a, value_type2 const & b) constexpr noexcept
+            {
+                using result_type = decltype (std::lcm (a, b));
+
+                auto const x = unsigned_magnitude (
+                    static_cast <result_type> (a)
+                );
+                auto const y = unsigned_magnitude (
+                    static_cast <result_type> (b)
+                );
+                auto const g = binary_gcd (x, y);
+
+                return g == decltype (g) {0}
+                    ? result_type {0}
+                    : static_cast <result_type> ((x / g) * y);
+            },
+            u, v
+        );
+    }
+
+    /*
+     * Computes the clamped value for each lane of a SIMD vector.
+     */
+    template <typename SIMDType>
+    simd_always_inline constexpr SIMDType
+        clamp (SIMDType const & u, SIMDType const & lo, SIMDType const & hi)
+        noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+
+        /* written as by-value min (max (u, lo), hi) rather than std::clamp,
+           whose by-reference result blocks the compilers from folding the
+           lane loop into the vector min/max instructions */
+        return transform (
+            [] (value_type const & val,
+                value_type const & l,
+                value_type const & h) constexpr noexcept
+            {
+                value_type const raised = val < l ? l : val;
+                return h < raised ? h : raised;
+            },
+            u, lo, hi
+        );
+    }
+
+    /*
+     * Computes the clamped value for each lane of a SIMD vector using the
+     * provided comparison function.
+     */
+    template <typename SIMDType, typename Compare>
+    simd_always_inline constexpr SIMDType clamp (SIMDType const & u,
+                              SIMDType const & lo,
+                              SIMDType const & hi,
+                              Compare && comp)
+        noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+
+        return transform (
+            [c = std::forward <Compare> (comp)] (value_type const & val,
+                                                 value_type const & l,
+                                                 value_type const & h)
+                constexpr noexcept
+            {
+                return std::clamp (val, l, h, c);
+            },
+            u, lo, hi
+        );
+    }
 #endif
-}   // inline namespace common
 
     /*
-     * These are target technology specific typedefs for SIMD vector types, for
-     * when it is undesirable to allow Clang or GCC to synthesize instructions
-     * for the target archetecture.
-     *
-     * Please note that for any given target technology Clang and GCC
-     * may still have to synthesize instructions if operations that are
-     * not backed by hardware support are used. It is up to the end-user
-     * to ensure that the used operations have hardware support.
+     * The approx namespace provides fast approximate counterparts to selected
+     * math functions. These trade the last few units of precision for
+     * branchless whole-vector evaluation and must be opted into explicitly;
+     * the enclosing functions in namespace math remain exact with respect to
+     * their std:: counterparts.
      */
-namespace mmx
+namespace approx
 {
-    /* mmx registers (64-bit) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+    /*
+     * Computes an approximate cube root for each lane of a floating point
+     * SIMD vector. The IEEE-754 exponent of each lane is divided by three to
+     * obtain a seed which is then refined with two Halley iterations,
+     * yielding a relative error of a few ulp for float lanes. The sign bit is
+     * carried through untouched; zeros, infinities, NaNs, and denormal
+     * values are not handled exactly.
+     */
+    template <typename SIMDType>
+    simd_always_inline SIMDType cbrt (SIMDType const & v) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+        static_assert (
+            std::is_same <value_type, float>::value ||
+            std::is_same <value_type, double>::value,
+            "approximate cbrt requires float or double lanes"
+        );
 
-    /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
+        using bits_type = simd_type <integral_type, traits_type::lanes>;
 
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
-}   // namespace mmx
+        /* sign bit of each lane */
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
 
-namespace sse
-{
-    /* mmx registers (64-bit) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+        /* two thirds of the IEEE-754 exponent bias, scaled into place */
+        static constexpr integral_type seed_bias =
+            std::is_same <value_type, float>::value ?
+                integral_type {709921077} :
+                (integral_type {1023} << 52) * 2 / 3;
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+        auto const bits      = v.template as <bits_type> ();
+        auto const sign_bits = bits & bits_type {sign_mask};
+        auto const abs_bits  = bits & ~bits_type {sign_mask};
+        auto const x         = abs_bits.template as <SIMDType> ();
 
-    /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
+        auto y = (abs_bits / bits_type {integral_type {3}} +
+                  bits_type {seed_bias}).template as <SIMDType> ();
 
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
+        auto const two = SIMDType {value_type {2.0}};
 
-    /* xmm registers (128-bit) */
-    /* 4 32 bit lanes */
-    using float32x4_t         = simd_type <float, 4>;
-    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
-}   // namespace sse
+        auto y3 = y * y * y;
+        y  = y * (y3 + two * x) / (two * y3 + x);
+        y3 = y * y * y;
+        y  = y * (y3 + two * x) / (two * y3 + x);
 
-namespace sse2
-{
-    /* mmx registers (64-bit) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+        return (y.template as <bits_type> () | sign_bits)
+            .template as <SIMDType> ();
+    }
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+    /*
+     * Computes an approximate natural logarithm for each lane of a float
+     * SIMD vector. The IEEE-754 exponent provides the integral part of the
+     * base-2 logarithm directly; the top eight mantissa bits index a 256
+     * entry midpoint table for the fractional part, and the sum is rescaled
+     * to base e. Absolute error is on the order of 1e-3, suitable for
+     * probability and scoring workloads. Arguments must be positive, finite,
+     * and normal; other inputs yield unspecified values.
+     */
+    template <typename SIMDType>
+    SIMDType log (SIMDType const & v) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
+        using signed_type   = typename traits_type::signed_integral_type;
 
-    /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
+        static_assert (
+            std::is_same <value_type, float>::value,
+            "approximate log requires float lanes"
+        );
 
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
+        using bits_type   = simd_type <integral_type, traits_type::lanes>;
+        using signed_bits = simd_type <signed_type, traits_type::lanes>;
 
-    /* xmm registers (128-bit) */
-    /* 16 8-bit lanes */
-    using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
-    using int8x16_t  = simd_type <std::int8_t, 16>;
-    using uint8x16_t = simd_type <std::uint8_t, 16>;
+        /* log2 (1 + (i + 1/2) / 256) for each possible index */
+        static std::array <float, 256> const table = [] (void)
+        {
+            std::array <float, 256> t {};
+            for (std::size_t i = 0; i < 256; ++i) {
+                t [i] = static_cast <float> (
+                    std::log2 (1.0 + (static_cast <double> (i) + 0.5) / 256.0)
+                );
+            }
+            return t;
+        } ();
 
-    /* 8 16-bit lanes */
-    using bool16x8_t = simd_type <std::int16_t, 8, boolean_tag>;
-    using int16x8_t  = simd_type <std::int16_t, 8>;
-    using uint16x8_t = simd_type <std::uint16_t, 8>;
+        auto const bits = v.template as <bits_type> ();
+        auto const exponent =
+            ((bits >> integral_type {23}).template to <signed_bits> () -
+             signed_type {127})
+                .template to <SIMDType> ();
 
-    /* 4 32-bit lanes */
-    using bool32x4_t          = simd_type <std::int32_t, 4, boolean_tag>;
-    using int32x4_t           = simd_type <std::int32_t, 4>;
-    using uint32x4_t          = simd_type <std::uint32_t, 4>;
-    using float32x4_t         = simd_type <float, 4>;
-    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
+        std::array <value_type, traits_type::lanes> fractions;
+        for (std::size_t i = 0; i < traits_type::lanes; ++i) {
+            fractions [i] = table [(bits.value (i) >> 15) & 0xFF];
+        }
+        SIMDType const mantissa_log {fractions};
 
-    /* 2 64-bit lanes */
-    using bool64x2_t          = simd_type <std::int64_t, 2, boolean_tag>;
-    using int64x2_t           = simd_type <std::int64_t, 2>;
-    using uint64x2_t          = simd_type <std::uint64_t, 2>;
-    using float64x2_t         = simd_type <double, 2>;
-    using complex_float64x2_t = simd_type <double, 2, complex_tag>;
+        /* convert the base-2 result to base e */
+        return (exponent + mantissa_log) * SIMDType {0.693147181f};
+    }
 
-    /* 1 128-bit lane (x86 doublequadword) */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
-#endif
-}   // namespace sse2
+    /*
+     * Computes an approximate exponential for each lane of a float SIMD
+     * vector. The argument is rescaled to a base-2 exponent whose integral
+     * part becomes the IEEE-754 exponent directly and whose fractional part
+     * indexes a 256 entry midpoint table. Relative error is on the order of
+     * 1e-3. Arguments must be finite with magnitude below the overflow
+     * threshold (roughly 87 for float lanes); other inputs yield unspecified
+     * values.
+     */
+    template <typename SIMDType>
+    SIMDType exp (SIMDType const & v) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using signed_type = typename traits_type::signed_integral_type;
 
-/*
- * Available types in SSE3/4.1/4.2 and SSE4a (AMD) are the same as those
- * availalbe in SSE2 since no new registers beyond the MMX and XMM registers
- * were introduced (256 bit registers were not available until the AVX
- * extensions).
- */
-namespace sse3
-{
-    /* mmx registers (64-bit) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+        static_assert (
+            std::is_same <value_type, float>::value,
+            "approximate exp requires float lanes"
+        );
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+        using signed_bits = simd_type <signed_type, traits_type::lanes>;
 
-    /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
+        /* 2^((i + 1/2) / 256) for each possible index */
+        static std::array <float, 256> const table = [] (void)
+        {
+            std::array <float, 256> t {};
+            for (std::size_t i = 0; i < 256; ++i) {
+                t [i] = static_cast <float> (
+                    std::exp2 ((static_cast <double> (i) + 0.5) / 256.0)
+                );
+            }
+            return t;
+        } ();
 
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
+        /* rescale to base 2: e^v == 2^(v * log2 (e)) */
+        auto const y = v * SIMDType {1.44269504f};
 
-    /* xmm registers (128-bit) */
-    /* 16 8-bit lanes */
-    using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
-    using int8x16_t  = simd_type <std::int8_t, 16>;
-    using uint8x16_t = simd_type <std::uint8_t, 16>;
+        std::array <value_type, traits_type::lanes> floors;
+        std::array <value_type, traits_type::lanes> fractions;
+        for (std::size_t i = 0; i < traits_type::lanes; ++i) {
+            auto const lane = y.value (i);
+            floors [i]    = std::floor (lane);
+            fractions [i] = table [
+                static_cast <std::size_t> ((lane - floors [i]) * 256.0f)
+            ];
+        }
+        SIMDType const integral_part {floors};
+        SIMDType const fractional_pow {fractions};
 
-    /* 8 16-bit lanes */
-    using bool16x8_t = simd_type <std::int16_t, 8, boolean_tag>;
-    using int16x8_t  = simd_type <std::int16_t, 8>;
-    using uint16x8_t = simd_type <std::uint16_t, 8>;
+        /* build 2^integral_part by placing the exponent bits directly */
+        auto const scale =
+            ((integral_part.template to <signed_bits> () + signed_type {127})
+                << 23).template as <SIMDType> ();
 
-    /* 4 32-bit lanes */
-    using bool32x4_t          = simd_type <std::int32_t, 4, boolean_tag>;
-    using int32x4_t           = simd_type <std::int32_t, 4>;
-    using uint32x4_t          = simd_type <std::uint32_t, 4>;
-    using float32x4_t         = simd_type <float, 4>;
-    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
+        return fractional_pow * scale;
+    }
 
-    /* 2 64-bit lanes */
-    using bool64x2_t          = simd_type <std::int64_t, 2, boolean_tag>;
-    using int64x2_t           = simd_type <std::int64_t, 2>;
-    using uint64x2_t          = simd_type <std::uint64_t, 2>;
-    using float64x2_t         = simd_type <double, 2>;
-    using complex_float64x2_t = simd_type <double, 2, complex_tag>;
+    /*
+     * Quantizes each lane of a float SIMD vector to bfloat16 precision,
+     * keeping the float representation. The low sixteen mantissa bits are
+     * rounded away to nearest (ties to even), which matches the narrowing
+     * conversion of the bfloat16 formats used by throughput oriented
+     * workloads. Useful for shrinking the meaningful payload of values that
+     * feed the approximate functions above, or before narrowing stores, when
+     * eight mantissa bits suffice. Infinities and NaN values are preserved.
+     */
+    template <typename SIMDType>
+    SIMDType quantize_bf16 (SIMDType const & v) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
 
-    /* 1 128-bit lane (x86 doublequadword) */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
-#endif
-}   // namespace sse3
+        static_assert (
+            std::is_same <value_type, float>::value,
+            "bfloat16 quantization requires float lanes"
+        );
 
-namespace ssse3
-{
-    /* mmx registers (64-bit) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+        using bits_type = simd_type <integral_type, traits_type::lanes>;
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+        auto const bits = v.template as <bits_type> ();
+        auto const rounded = bits +
+            ((bits >> integral_type {16}) & integral_type {1}) +
+            integral_type {0x7FFF};
+        auto const quantized = rounded & ~integral_type {0xFFFF};
 
-    /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
+        /*
+         * Lanes with an all-ones exponent field keep their original bits:
+         * the rounding add above carries out of the mantissa for NaN
+         * payloads, turning small payloads into infinities and large
+         * payloads into signed zeros. The blend is the weighted sum used
+         * by the other lane-class dispatches.
+         */
+        auto const special =
+            (bits & integral_type {0x7F800000}) ==
+                bits_type {integral_type {0x7F800000}};
 
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
+        return (special.template to <bits_type> () * bits +
+                (!special).template to <bits_type> () * quantized)
+            .template as <SIMDType> ();
+    }
 
-    /* xmm registers (128-bit) */
-    /* 16 8-bit lanes */
-    using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
-    using int8x16_t  = simd_type <std::int8_t, 16>;
-    using uint8x16_t = simd_type <std::uint8_t, 16>;
+    /*
+     * Rounds each lane of a float or double SIMD vector to the nearest long,
+     * halfway cases away from zero, entirely with whole-vector operations:
+     * one half with the sign of the lane is added before a truncating vector
+     * conversion. Unlike std::lround this pre-addition is itself a rounded
+     * floating point operation, so lanes within one ulp below an exact half
+     * integer boundary may round differently; lanes outside the range of
+     * long yield unspecified values.
+     */
+    template <typename SIMDType>
+    simd_type <long, simd_traits <SIMDType>::lanes>
+    lround (SIMDType const & v) noexcept
+    {
+        using traits_type   = simd_traits <SIMDType>;
+        using value_type    = typename traits_type::value_type;
+        using integral_type = typename traits_type::unsigned_integral_type;
 
-    /* 8 16-bit lanes */
-    using bool16x8_t = simd_type <std::int16_t, 8, boolean_tag>;
-    using int16x8_t  = simd_type <std::int16_t, 8>;
-    using uint16x8_t = simd_type <std::uint16_t, 8>;
+        static_assert (
+            std::is_same <value_type, float>::value ||
+            std::is_same <value_type, double>::value,
+            "approximate lround requires float or double lanes"
+        );
 
-    /* 4 32-bit lanes */
-    using bool32x4_t          = simd_type <std::int32_t, 4, boolean_tag>;
-    using int32x4_t           = simd_type <std::int32_t, 4>;
-    using uint32x4_t          = simd_type <std::uint32_t, 4>;
-    using float32x4_t         = simd_type <float, 4>;
-    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
+        using bits_type = simd_type <integral_type, traits_type::lanes>;
 
-    /* 2 64-bit lanes */
-    using bool64x2_t          = simd_type <std::int64_t, 2, boolean_tag>;
-    using int64x2_t           = simd_type <std::int64_t, 2>;
-    using uint64x2_t          = simd_type <std::uint64_t, 2>;
-    using float64x2_t         = simd_type <double, 2>;
-    using complex_float64x2_t = simd_type <double, 2, complex_tag>;
+        static constexpr integral_type sign_mask =
+            integral_type {1} << (sizeof (value_type) * 8 - 1);
+        /* bit pattern of one half for the lane type */
+        static constexpr integral_type half_bits =
+            std::is_same <value_type, float>::value ?
+                integral_type {0x3F000000} :
+                integral_type {1022} << 52;
+
+        auto const sign_bits =
+            v.template as <bits_type> () & bits_type {sign_mask};
+        auto const half =
+            (sign_bits | bits_type {half_bits}).template as <SIMDType> ();
+
+        return (v + half)
+            .template to <simd_type <long, traits_type::lanes>> ();
+    }
+
+    /*
+     * Rounds each lane of a float or double SIMD vector to the nearest
+     * long long, halfway cases away from zero; see lround above for the
+     * mechanism and caveats.
+     */
+    template <typename SIMDType>
+    simd_type <long long, simd_traits <SIMDType>::lanes>
+    llround (SIMDType const & v) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+
+        return lround (v)
+            .template to <simd_type <long long, traits_type::lanes>> ();
+    }
+
+    /*
+     * Computes the floating point remainder of u / v for each lane of float
+     * or double SIMD vectors as u - trunc (u / v) * v, keeping the whole
+     * computation in vector registers instead of calling libm per lane. The
+     * division and multiplication are themselves rounded, so lanes where the
+     * quotient is very large or where u / v lands within one ulp of an
+     * integer may differ from std::fmod by one ulp of v; infinities and NaN
+     * lanes follow the arithmetic rather than the libm special cases.
+     */
+    template <typename SIMDType>
+    SIMDType fmod (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
 
-    /* 1 128-bit lane (x86 doublequadword) */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
-#endif
-}   // namespace ssse3
+        static_assert (
+            std::is_same <value_type, float>::value ||
+            std::is_same <value_type, double>::value,
+            "approximate fmod requires float or double lanes"
+        );
 
-namespace sse4
-{
-    /* mmx registers (64-bit) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+        return u - trunc (u / v) * v;
+    }
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+    /*
+     * Computes the IEEE remainder of u / v for each lane of float or double
+     * SIMD vectors as u - nearbyint (u / v) * v, with the quotient rounded
+     * to the nearest integer, ties to even; see fmod above for the rounding
+     * caveats relative to std::remainder.
+     */
+    template <typename SIMDType>
+    SIMDType remainder (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
 
-    /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
+        static_assert (
+            std::is_same <value_type, float>::value ||
+            std::is_same <value_type, double>::value,
+            "approximate remainder requires float or double lanes"
+        );
 
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
+        return u - nearbyint (u / v) * v;
+    }
 
-    /* xmm registers (128-bit) */
-    /* 16 8-bit lanes */
-    using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
-    using int8x16_t  = simd_type <std::int8_t, 16>;
-    using uint8x16_t = simd_type <std::uint8_t, 16>;
+    /*
+     * Computes the IEEE remainder and the low bits of the integral quotient
+     * of u / v for each lane of float or double SIMD vectors, entirely with
+     * whole-vector operations: the quotient is rounded to the nearest
+     * integer once and shared between both results. As with remainder above
+     * the reduction is rounded, so lanes near quotient halfway points may
+     * disagree with std::remquo in the last bit of the remainder and by one
+     * in the quotient; the quotient member carries the sign of u / v and
+     * its three low magnitude bits, as the C specification requires.
+     */
+    template <typename SIMDType>
+    remquo_result <SIMDType>
+    remquo (SIMDType const & u, SIMDType const & v) noexcept
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+        using signed_type = typename traits_type::signed_integral_type;
 
-    /* 8 16-bit lanes */
-    using bool16x8_t = simd_type <std::int16_t, 8, boolean_tag>;
-    using int16x8_t  = simd_type <std::int16_t, 8>;
-    using uint16x8_t = simd_type <std::uint16_t, 8>;
+        static_assert (
+            std::is_same <value_type, float>::value ||
+            std::is_same <value_type, double>::value,
+            "approximate remquo requires float or double lanes"
+        );
 
-    /* 4 32-bit lanes */
-    using bool32x4_t          = simd_type <std::int32_t, 4, boolean_tag>;
-    using int32x4_t           = simd_type <std::int32_t, 4>;
-    using uint32x4_t          = simd_type <std::uint32_t, 4>;
-    using float32x4_t         = simd_type <float, 4>;
-    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
+        using signed_bits = simd_type <signed_type, traits_type::lanes>;
 
-    /* 2 64-bit lanes */
-    using bool64x2_t          = simd_type <std::int64_t, 2, boolean_tag>;
-    using int64x2_t           = simd_type <std::int64_t, 2>;
-    using uint64x2_t          = simd_type <std::uint64_t, 2>;
-    using float64x2_t         = simd_type <double, 2>;
-    using complex_float64x2_t = simd_type <double, 2, complex_tag>;
+        auto const quotient = nearbyint (u / v);
+        auto const rem      = u - quotient * v;
 
-    /* 1 128-bit lane (x86 doublequadword) */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
-#endif
-}   // namespace sse4
+        /* take the three low magnitude bits, then restore the sign */
+        auto const qi = quotient.template to <signed_bits> ();
+        auto const negative_mask =
+            qi >> signed_type {sizeof (signed_type) * 8 - 1};
+        auto const magnitude = (qi ^ negative_mask) - negative_mask;
+        auto const low_bits  =
+            ((magnitude & signed_bits {signed_type {7}}) ^ negative_mask) -
+                negative_mask;
 
-namespace sse4_1 = sse4;
-namespace sse4_2 = sse4;
+        return remquo_result <SIMDType> {
+            rem,
+            low_bits.template to <simd_type <int, traits_type::lanes>> ()
+        };
+    }
+}   // namespace approx
+}   // namespace math
 
-namespace sse4a
+    /*
+     * These are the default provided typedefs for SIMD vector types, they cover
+     * the normal range of vector types available on targets with 64 bit,
+     * 128 bit, 256 bit, and/or 512 bit support. Clang and GCC will synthesize
+     * instructions when target hardware support is not available, so we
+     * provide all common SIMD vector types. Target specific typedefs are
+     * provided below.
+     */
+inline namespace common
 {
-    /* mmx registers (64-bit) */
     /* 8 8-bit lanes */
     using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
     using int8x8_t  = simd_type <std::int8_t, 8>;
     using uint8x8_t = simd_type <std::uint8_t, 8>;
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
-
-    /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
-
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
-
-    /* xmm registers (128-bit) */
     /* 16 8-bit lanes */
     using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
     using int8x16_t  = simd_type <std::int8_t, 16>;
     using uint8x16_t = simd_type <std::uint8_t, 16>;
 
-    /* 8 16-bit lanes */
-    using bool16x8_t = simd_type <std::int16_t, 8, boolean_tag>;
-    using int16x8_t  = simd_type <std::int16_t, 8>;
-    using uint16x8_t = simd_type <std::uint16_t, 8>;
-
-    /* 4 32-bit lanes */
-    using bool32x4_t          = simd_type <std::int32_t, 4, boolean_tag>;
-    using int32x4_t           = simd_type <std::int32_t, 4>;
-    using uint32x4_t          = simd_type <std::uint32_t, 4>;
-    using float32x4_t         = simd_type <float, 4>;
-    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
-
-    /* 2 64-bit lanes */
-    using bool64x2_t          = simd_type <std::int64_t, 2, boolean_tag>;
-    using int64x2_t           = simd_type <std::int64_t, 2>;
-    using uint64x2_t          = simd_type <std::uint64_t, 2>;
-    using float64x2_t         = simd_type <double, 2>;
-    using complex_float64x2_t = simd_type <double, 2, complex_tag>;
-
-    /* 1 128-bit lane (x86 doublequadword) */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
-#endif
-}   // namespace sse4a
+    /* 32 8-bit lanes */
+    using bool8x32_t = simd_type <std::int8_t, 32, boolean_tag>;
+    using int8x32_t  = simd_type <std::int8_t, 32>;
+    using uint8x32_t = simd_type <std::uint8_t, 32>;
 
-namespace avx
-{
-    /* mmx registers (64-bit) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+    /* 64 8-bit lanes */
+    using bool8x64_t = simd_type <std::int8_t, 64, boolean_tag>;
+    using int8x64_t  = simd_type <std::int8_t, 64>;
+    using uint8x64_t = simd_type <std::uint8_t, 64>;
 
     /* 4 16-bit lanes */
     using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
     using int16x4_t  = simd_type <std::int16_t, 4>;
     using uint16x4_t = simd_type <std::uint16_t, 4>;
 
-    /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
-
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
-
-    /* xmm registers (128-bit) */
-    /* 16 8-bit lanes */
-    using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
-    using int8x16_t  = simd_type <std::int8_t, 16>;
-    using uint8x16_t = simd_type <std::uint8_t, 16>;
-
     /* 8 16-bit lanes */
     using bool16x8_t = simd_type <std::int16_t, 8, boolean_tag>;
     using int16x8_t  = simd_type <std::int16_t, 8>;
     using uint16x8_t = simd_type <std::uint16_t, 8>;
 
+    /* 16 16-bit lanes */
+    using bool16x16_t = simd_type <std::int16_t, 16, boolean_tag>;
+    using int16x16_t  = simd_type <std::int16_t, 16>;
+    using uint16x16_t = simd_type <std::uint16_t, 16>;
+
+    /* 32 16-bit lanes */
+    using bool16x32_t = simd_type <std::int16_t, 32, boolean_tag>;
+    using int16x32_t  = simd_type <std::int16_t, 32>;
+    using uint16x32_t = simd_type <std::uint16_t, 32>;
+
+    /* 2 32-bit lanes */
+    using bool32x2_t          = simd_type <std::int32_t, 2, boolean_tag>;
+    using int32x2_t           = simd_type <std::int32_t, 2>;
+    using uint32x2_t          = simd_type <std::uint32_t, 2>;
+    using float32x2_t         = simd_type <float, 2>;
+    using complex_float32x2_t = simd_type <float, 2, complex_tag>;
+
     /* 4 32-bit lanes */
     using bool32x4_t          = simd_type <std::int32_t, 4, boolean_tag>;
     using int32x4_t           = simd_type <std::int32_t, 4>;
@@ -10682,6 +12388,27 @@ namespace avx
     using float32x4_t         = simd_type <float, 4>;
     using complex_float32x4_t = simd_type <float, 4, complex_tag>;
 
+    /* 8 32-bit lanes */
+    using bool32x8_t          = simd_type <std::int32_t, 8, boolean_tag>;
+    using int32x8_t           = simd_type <std::int32_t, 8>;
+    using uint32x8_t          = simd_type <std::uint32_t, 8>;
+    using float32x8_t         = simd_type <float, 8>;
+    using complex_float32x8_t = simd_type <float, 8, complex_tag>;
+
+    /* 16 32-bit lanes */
+    using bool32x16_t          = simd_type <std::int32_t, 16, boolean_tag>;
+    using int32x16_t           = simd_type <std::int32_t, 16>;
+    using uint32x16_t          = simd_type <std::uint32_t, 16>;
+    using float32x16_t         = simd_type <float, 16>;
+    using complex_float32x16_t = simd_type <float, 16, complex_tag>;
+
+    /* 1 64-bit lane */
+    using bool64x1_t          = simd_type <std::int64_t, 1, boolean_tag>;
+    using int64x1_t           = simd_type <std::int64_t, 1>;
+    using uint64x1_t          = simd_type <std::uint64_t, 1>;
+    using float64x1_t         = simd_type <double, 1>;
+    using complex_float64x1_t = simd_type <double, 1, complex_tag>;
+
     /* 2 64-bit lanes */
     using bool64x2_t          = simd_type <std::int64_t, 2, boolean_tag>;
     using int64x2_t           = simd_type <std::int64_t, 2>;
@@ -10689,28 +12416,88 @@ namespace avx
     using float64x2_t         = simd_type <double, 2>;
     using complex_float64x2_t = simd_type <double, 2, complex_tag>;
 
-    /* 1 128-bit lane (x86 doublequadword) */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
-#endif
-
-    /* ymm registers (256-bit) */
-    /* 8 32-bit lanes */
-    using float32x8_t         = simd_type <float, 8>;
-    using complex_float32x8_t = simd_type <float, 8, complex_tag>;
-
     /* 4 64-bit lanes */
+    using bool64x4_t          = simd_type <std::int64_t, 4, boolean_tag>;
+    using int64x4_t           = simd_type <std::int64_t, 4>;
+    using uint64x4_t          = simd_type <std::uint64_t, 4>;
     using float64x4_t         = simd_type <double, 4>;
     using complex_float64x4_t = simd_type <double, 4, complex_tag>;
-}   // namespace avx
 
-namespace avx2
+    /* 8 64-bit lanes */
+    using bool64x8_t          = simd_type <std::int64_t, 8, boolean_tag>;
+    using int64x8_t           = simd_type <std::int64_t, 8>;
+    using uint64x8_t          = simd_type <std::uint64_t, 8>;
+    using float64x8_t         = simd_type <double, 8>;
+    using complex_float64x8_t = simd_type <float, 8, complex_tag>;
+
+    /*
+     * long double specializations; may be 80-bit (x87), 128-bit,
+     * or even a synonym for double floating point types depending
+     * on the implementation.
+     */
+
+    /* long double x 2 */
+    using long_doublex2_t         = simd_type <long double, 2>;
+    using complex_long_doublex2_t = simd_type <long double, 2, complex_tag>;
+
+    /* long double x 4 */
+    using long_doublex4_t         = simd_type <long double, 4>;
+    using complex_long_doublex4_t = simd_type <long double, 4, complex_tag>;
+
+    /* Guaranteed 128-bit integer SIMD vectors */
+    /* 1 128-bit lane */
+#if defined (__SIZEOF_INT128__)
+    using bool128x1_t = simd_type <detail::i128, 1, boolean_tag>;
+    using int128x1_t  = simd_type <detail::i128, 1>;
+    using uint128x1_t = simd_type <detail::u128, 1>;
+#endif   // defined (__SIZEOF_INT128__)
+
+    /* 2 128-bit lanes */
+#if defined (__SIZEOF_INT128__)
+    using bool128x2_t = simd_type <detail::i128, 2, boolean_tag>;
+    using int128x2_t  = simd_type <detail::i128, 2>;
+    using uint128x2_t = simd_type <detail::u128, 2>;
+#endif   // defined (__SIZEOF_INT128__)
+
+    /* 4 128-bit lanes */
+#if defined (__SIZEOF_INT128__)
+    using bool128x4_t = simd_type <detail::i128, 4, boolean_tag>;
+    using int128x4_t  = simd_type <detail::i128, 4>;
+    using uint128x4_t = simd_type <detail::u128, 4>;
+#endif   // defined (__SIZEOF_INT128__)
+}   // inline namespace common
+
+    /*
+     * These are target technology specific typedefs for SIMD vector types, for
+     * when it is undesirable to allow Clang or GCC to synthesize instructions
+     * for the target archetecture.
+     *
+     * Please note that for any given target technology Clang and GCC
+     * may still have to synthesize instructions if operations that are
+     * not backed by hardware support are used. It is up to the end-user
+     * to ensure that the used operations have hardware support.
+     *
+     * The aliases themselves are portable: each names an ordinary
+     * simd_type specialization of the matching width, built on the
+     * compiler vector extensions rather than on technology intrinsics,
+     * and therefore compiles on any host. Kernels written against
+     * simd::neon types build on x86 with SSE/AVX codegen and kernels
+     * written against the SSE/AVX namespaces build on ARM with
+     * NEON/SVE codegen; no intrinsic emulation layer (SIMDe and the
+     * like) is needed to move single-source kernels between
+     * archetectures. The namespace name records the register shape the
+     * kernel was written for, not a requirement on the host.
+     */
+/*
+ * The per-technology namespaces below share most of their type aliases: the
+ * aliases are therefore declared once per register class in the detail
+ * namespaces that follow and pulled into each technology namespace with a
+ * using directive. The aliases remain the same simd_type specializations in
+ * every namespace that nominates them.
+ */
+namespace detail
+{
+namespace iset_mmx
 {
     /* mmx registers (64-bit) */
     /* 8 8-bit lanes */
@@ -10732,7 +12519,10 @@ namespace avx2
     using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
     using int64x1_t  = simd_type <std::int64_t, 1>;
     using uint64x1_t = simd_type <std::uint64_t, 1>;
+}   // namespace iset_mmx
 
+namespace iset_xmm
+{
     /* xmm registers (128-bit) */
     /* 16 8-bit lanes */
     using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
@@ -10759,56 +12549,155 @@ namespace avx2
     using complex_float64x2_t = simd_type <double, 2, complex_tag>;
 
     /* 1 128-bit lane (x86 doublequadword) */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
-#endif
-
-    /* ymm registers (256-bit) */
+#if defined (__SIZEOF_INT128__)
+    using bool128x1_t = simd_type <i128, 1, boolean_tag>;
+    using int128x1_t  = simd_type <i128, 1>;
+    using uint128x1_t = simd_type <u128, 1>;
+#endif   // defined (__SIZEOF_INT128__)
+}   // namespace iset_xmm
+
+namespace iset_ymm_fp
+{
+    /* ymm registers (256-bit) -- floating point lanes only */
     /* 8 32-bit lanes */
-    using bool32x8_t          = simd_type <std::int32_t, 8, boolean_tag>;
-    using int32x8_t           = simd_type <std::int32_t, 8>;
-    using uint32x8_t          = simd_type <std::uint32_t, 8>;
     using float32x8_t         = simd_type <float, 8>;
     using complex_float32x8_t = simd_type <float, 8, complex_tag>;
 
     /* 4 64-bit lanes */
-    using bool64x4_t          = simd_type <std::int64_t, 4, boolean_tag>;
-    using int64x4_t           = simd_type <std::int64_t, 4>;
-    using uint64x4_t          = simd_type <std::uint64_t, 4>;
     using float64x4_t         = simd_type <double, 4>;
     using complex_float64x4_t = simd_type <double, 4, complex_tag>;
+}   // namespace iset_ymm_fp
+
+namespace iset_ymm_int
+{
+    /* ymm registers (256-bit) -- integral and boolean lanes */
+    /* 8 32-bit lanes */
+    using bool32x8_t = simd_type <std::int32_t, 8, boolean_tag>;
+    using int32x8_t  = simd_type <std::int32_t, 8>;
+    using uint32x8_t = simd_type <std::uint32_t, 8>;
+
+    /* 4 64-bit lanes */
+    using bool64x4_t = simd_type <std::int64_t, 4, boolean_tag>;
+    using int64x4_t  = simd_type <std::int64_t, 4>;
+    using uint64x4_t = simd_type <std::uint64_t, 4>;
+}   // namespace iset_ymm_int
+
+namespace iset_zmm
+{
+    /* zmm registers (512-bit) */
+    /* 64 8-bit lanes (AVX-512BW shapes; quantized kernel operands) */
+    using bool8x64_t = simd_type <std::int8_t, 64, boolean_tag>;
+    using int8x64_t  = simd_type <std::int8_t, 64>;
+    using uint8x64_t = simd_type <std::uint8_t, 64>;
+
+    /* 32 16-bit lanes (AVX-512BW shapes) */
+    using bool16x32_t = simd_type <std::int16_t, 32, boolean_tag>;
+    using int16x32_t  = simd_type <std::int16_t, 32>;
+    using uint16x32_t = simd_type <std::uint16_t, 32>;
+
+    /* 16 32-bit lanes */
+    using bool32x16_t          = simd_type <std::int32_t, 16, boolean_tag>;
+    using int32x16_t           = simd_type <std::int32_t, 16>;
+    using uint32x16_t          = simd_type <std::uint32_t, 16>;
+    using float32x16_t         = simd_type <float, 16>;
+    using complex_float32x16_t = simd_type <float, 16, complex_tag>;
+
+    /* 8 64-bit lanes */
+    using bool64x8_t          = simd_type <std::int64_t, 8, boolean_tag>;
+    using int64x8_t           = simd_type <std::int64_t, 8>;
+    using uint64x8_t          = simd_type <std::uint64_t, 8>;
+    using float64x8_t         = simd_type <double, 8>;
+    using complex_float64x8_t = simd_type <double, 8, complex_tag>;
+}   // namespace iset_zmm
+}   // namespace detail
+
+namespace mmx
+{
+    using namespace detail::iset_mmx;
+}   // namespace mmx
+
+namespace sse
+{
+    using namespace detail::iset_mmx;
+
+    /* xmm registers (128-bit) */
+    /* 4 32 bit lanes */
+    using float32x4_t         = simd_type <float, 4>;
+    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
+}   // namespace sse
+
+namespace sse2
+{
+    using namespace detail::iset_mmx;
+    using namespace detail::iset_xmm;
+}   // namespace sse2
+
+/*
+ * Available types in SSE3/4.1/4.2 and SSE4a (AMD) are the same as those
+ * availalbe in SSE2 since no new registers beyond the MMX and XMM registers
+ * were introduced (256 bit registers were not available until the AVX
+ * extensions).
+ */
+namespace sse3
+{
+    using namespace detail::iset_mmx;
+    using namespace detail::iset_xmm;
+}   // namespace sse3
+
+namespace ssse3
+{
+    using namespace detail::iset_mmx;
+    using namespace detail::iset_xmm;
+}   // namespace ssse3
+
+namespace sse4
+{
+    using namespace detail::iset_mmx;
+    using namespace detail::iset_xmm;
+}   // namespace sse4
+
+namespace sse4_1 = sse4;
+namespace sse4_2 = sse4;
+
+namespace sse4a
+{
+    using namespace detail::iset_mmx;
+    using namespace detail::iset_xmm;
+}   // namespace sse4a
+
+namespace avx
+{
+    using namespace detail::iset_mmx;
+    using namespace detail::iset_xmm;
+    using namespace detail::iset_ymm_fp;
+}   // namespace avx
+
+namespace avx2
+{
+    using namespace detail::iset_mmx;
+    using namespace detail::iset_xmm;
+    using namespace detail::iset_ymm_fp;
+    using namespace detail::iset_ymm_int;
 }   // namespace avx2
 
 namespace avx512
 {
-    /* mmx registers (64-bit) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+    using namespace detail::iset_mmx;
+    using namespace detail::iset_xmm;
+    using namespace detail::iset_ymm_fp;
+    using namespace detail::iset_ymm_int;
+    using namespace detail::iset_zmm;
+}   // namespace avx512
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+namespace neon
+{
+    /* 64-bit registers (ARM doubleword registers -- D0, D1, ...) */
+    using namespace detail::iset_mmx;
 
     /* 2 32-bit lanes */
-    using bool32x2_t = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t  = simd_type <std::int32_t, 2>;
-    using uint32x2_t = simd_type <std::uint32_t, 2>;
-
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
+    using float32x2_t = simd_type <float, 2>;
 
-    /* xmm registers (128-bit) */
+    /* 128-bit registers (ARM quadword registers -- Q0, Q1, ...) */
     /* 16 8-bit lanes */
     using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
     using int8x16_t  = simd_type <std::int8_t, 16>;
@@ -10826,102 +12715,362 @@ namespace avx512
     using float32x4_t         = simd_type <float, 4>;
     using complex_float32x4_t = simd_type <float, 4, complex_tag>;
 
-    /* 2 64-bit lanes */
-    using bool64x2_t          = simd_type <std::int64_t, 2, boolean_tag>;
-    using int64x2_t           = simd_type <std::int64_t, 2>;
-    using uint64x2_t          = simd_type <std::uint64_t, 2>;
-    using float64x2_t         = simd_type <double, 2>;
-    using complex_float64x2_t = simd_type <double, 2, complex_tag>;
+    /* 2 64-bit lane */
+    using bool64x2_t = simd_type <std::int64_t, 2, boolean_tag>;
+    using int64x2_t  = simd_type <std::int64_t, 2>;
+    using uint64x2_t = simd_type <std::uint64_t, 2>;
+}   // namespace neon
 
-    /* 1 128-bit lane (x86 doublequadword) */
-#if SIMD_HEADER_CLANG
-    using bool128x1_t = simd_type <__int128_t, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128_t, 1>;
-    using uint128x1_t = simd_type <__uint128_t, 1>;
-#elif SIMD_HEADER_GNUG
-    using bool128x1_t = simd_type <__int128, 1, boolean_tag>;
-    using int128x1_t  = simd_type <__int128, 1>;
-    using uint128x1_t = simd_type <unsigned __int128, 1>;
+    /*
+     * The scalable vector extensions (ARM SVE/SVE2, RISC-V RVV) expose
+     * length-agnostic registers whose sizeless types cannot be stored in
+     * class members, and so cannot back the fixed-width vector extension
+     * types this header is built on. Both GCC and Clang can, however,
+     * lower fixed-width vector types onto scalable registers when the
+     * register width is pinned at compile time (-msve-vector-bits=N and
+     * -mrvv-vector-bits=zvl, respectively). The namespaces below name the
+     * fixed widths scalable hardware is commonly deployed with; use the
+     * set matching the pinned register width.
+     */
+namespace sve
+{
+    /* 128-bit registers (architected minimum; Graviton2-class hardware) */
+    using namespace detail::iset_xmm;
+
+    /* 256-bit registers (Neoverse V1/V2, Graviton3) */
+    using namespace detail::iset_ymm_fp;
+    using namespace detail::iset_ymm_int;
+
+    /* 512-bit registers (A64FX-class hardware) */
+    using namespace detail::iset_zmm;
+}   // namespace sve
+
+namespace rvv
+{
+    /* Zvl128b (v extension baseline) */
+    using namespace detail::iset_xmm;
+
+    /* Zvl256b */
+    using namespace detail::iset_ymm_fp;
+    using namespace detail::iset_ymm_int;
+
+    /* Zvl512b */
+    using namespace detail::iset_zmm;
+}   // namespace rvv
+
+    /*
+     * Widest technology selection for the current translation unit. Unlike
+     * the namespaces above, which enumerate what a fixed technology
+     * provides, this one reflects whatever the active target flags enable:
+     * kernels written once against simd::best types pick up wider
+     * registers through a change of -m flags alone, with no source
+     * duplication per technology. vector_of names the register-filling
+     * vector for a lane type; the *_v aliases cover the common lane types.
+     * Combine with one translation unit per target setting and a
+     * simd::preferred_vector_bytes dispatch for single-binary deployment.
+     */
+namespace best
+{
+#if defined (__AVX512F__)
+    using namespace avx512;
+    constexpr std::size_t register_bytes = 64;
+#elif defined (__AVX2__)
+    using namespace avx2;
+    constexpr std::size_t register_bytes = 32;
+#elif defined (__AVX__)
+    using namespace avx;
+    constexpr std::size_t register_bytes = 32;
+#elif defined (__SSE2__)
+    using namespace sse2;
+    constexpr std::size_t register_bytes = 16;
+#elif defined (__ARM_NEON)
+    using namespace neon;
+    constexpr std::size_t register_bytes = 16;
+#else
+    /*
+     * No hardware vector extension detected; stay at a 128 bit width that
+     * the compilers synthesize reasonably on scalar targets.
+     */
+    constexpr std::size_t register_bytes = 16;
 #endif
 
-    /* ymm registers (256-bit) */
-    /* 8 32-bit lanes */
-    using bool32x8_t          = simd_type <std::int32_t, 8, boolean_tag>;
-    using int32x8_t           = simd_type <std::int32_t, 8>;
-    using uint32x8_t          = simd_type <std::uint32_t, 8>;
-    using float32x8_t         = simd_type <float, 8>;
-    using complex_float32x8_t = simd_type <float, 8, complex_tag>;
+    template <typename T>
+    using vector_of = simd_type <T, register_bytes / sizeof (T)>;
+
+    using int8_v    = vector_of <std::int8_t>;
+    using uint8_v   = vector_of <std::uint8_t>;
+    using int16_v   = vector_of <std::int16_t>;
+    using uint16_v  = vector_of <std::uint16_t>;
+    using int32_v   = vector_of <std::int32_t>;
+    using uint32_v  = vector_of <std::uint32_t>;
+    using int64_v   = vector_of <std::int64_t>;
+    using uint64_v  = vector_of <std::uint64_t>;
+    using float32_v = vector_of <float>;
+    using float64_v = vector_of <double>;
+
+    using bool8_v  = simd_type <std::int8_t, register_bytes, boolean_tag>;
+    using bool16_v = simd_type <std::int16_t, register_bytes / 2, boolean_tag>;
+    using bool32_v = simd_type <std::int32_t, register_bytes / 4, boolean_tag>;
+    using bool64_v = simd_type <std::int64_t, register_bytes / 8, boolean_tag>;
+
+    using complex_float32_v =
+        simd_type <float, register_bytes / 4, complex_tag>;
+    using complex_float64_v =
+        simd_type <double, register_bytes / 8, complex_tag>;
+}   // namespace best
 
-    /* 4 64-bit lanes */
-    using bool64x4_t          = simd_type <std::int64_t, 4, boolean_tag>;
-    using int64x4_t           = simd_type <std::int64_t, 4>;
-    using uint64x4_t          = simd_type <std::uint64_t, 4>;
-    using float64x4_t         = simd_type <double, 4>;
-    using complex_float64x4_t = simd_type <double, 4, complex_tag>;
+    /*
+     * A minimal C++11 allocator handing out memory aligned for a SIMD
+     * vector type (or to any explicitly requested alignment). Standard
+     * allocators align to alignof (std::max_align_t), commonly 16 bytes,
+     * so placing 32 or 64 byte vectors in a std::vector through the
+     * default allocator breaks the aligned load and store paths. Use as
+     *
+     *      std::vector <
+     *          simd::avx512::float32x16_t,
+     *          simd::aligned_allocator <simd::avx512::float32x16_t>
+     *      >
+     *
+     * The alignment defaults to the natural alignment of the value type,
+     * which for simd vector types covers the full register width, and so
+     * for 64 byte (zmm sized) vectors also guarantees that no two
+     * elements of an allocation share a cache line.
+     */
+    template <typename T, std::size_t Alignment = alignof (T)>
+    struct aligned_allocator
+    {
+        static_assert (
+            Alignment != 0 && (Alignment & (Alignment - 1)) == 0,
+            "alignment must be a power of two"
+        );
 
-    /* zmm registers (512-bit) */
-    /* 16 32-bit lanes */
-    using bool32x16_t          = simd_type <std::int32_t, 16, boolean_tag>;
-    using int32x16_t           = simd_type <std::int32_t, 16>;
-    using uint32x16_t          = simd_type <std::uint32_t, 16>;
-    using float32x16_t         = simd_type <float, 16>;
-    using complex_float32x16_t = simd_type <float, 16, complex_tag>;
+        static_assert (
+            Alignment >= alignof (T),
+            "alignment must be at least the natural alignment of T"
+        );
 
-    /* 8 64-bit lanes */
-    using bool64x8_t          = simd_type <std::int64_t, 8, boolean_tag>;
-    using int64x8_t           = simd_type <std::int64_t, 8>;
-    using uint64x8_t          = simd_type <std::uint64_t, 8>;
-    using float64x8_t         = simd_type <double, 8>;
-    using complex_float64x8_t = simd_type <double, 8, complex_tag>;
-}   // namespace avx512
+        using value_type      = T;
+        using pointer         = T *;
+        using const_pointer   = T const *;
+        using reference       = T &;
+        using const_reference = T const &;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
 
-namespace neon
+        static constexpr std::size_t alignment = Alignment;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = aligned_allocator <U, Alignment>;
+        };
+
+        aligned_allocator (void) noexcept = default;
+        aligned_allocator (aligned_allocator const &) noexcept = default;
+
+        template <typename U>
+        aligned_allocator (aligned_allocator <U, Alignment> const &) noexcept
+        {}
+
+        pointer allocate (size_type n)
+        {
+            /* see simd::allocator -- the guarantee travels with the
+             * returned pointer */
+            return static_cast <pointer> (
+                __builtin_assume_aligned (
+                    detail::util::aligned_allocate (n * sizeof (T), Alignment),
+                    Alignment
+                )
+            );
+        }
+
+        void deallocate (pointer p, size_type n) noexcept
+        {
+            detail::util::aligned_deallocate (p, n * sizeof (T), Alignment);
+        }
+    };
+
+    template <typename T, typename U, std::size_t Alignment>
+    bool operator== (aligned_allocator <T, Alignment> const &,
+                     aligned_allocator <U, Alignment> const &) noexcept
+    {
+        return true;
+    }
+
+    template <typename T, typename U, std::size_t Alignment>
+    bool operator!= (aligned_allocator <T, Alignment> const &,
+                     aligned_allocator <U, Alignment> const &) noexcept
+    {
+        return false;
+    }
+
+    /*
+     * Bit-packing of fixed 1024-value blocks of 32 bit integers in a
+     * transposed layout, for integer compression and decompression at
+     * memory bandwidth. The block is viewed as 32 interleaved lanes: lane
+     * j holds the values at indices j, j + 32, j + 64 and so on, and each
+     * lane packs its 32 values into width words of the output
+     * independently of every other lane. All loops below therefore have a
+     * 32-wide innermost dimension with no cross-iteration dependence,
+     * which the loop vectorizers of both supported compilers turn into
+     * full-width vector shifts and ors for whatever registers the active
+     * target provides -- the same codegen the intrinsics-based packing
+     * kernels hand-spell, without pinning the code to one technology.
+     * Compile the consuming translation unit with optimization enabled
+     * (-O2 or higher); the functions are correct but scalar without it.
+     *
+     * The packed stream for a block is exactly 32 * width words long (for
+     * packed_words (width) words), and the layout is a pure function of
+     * width: blocks can be decoded by any implementation of the same
+     * transposed layout. Values must fit in width bits; high bits beyond
+     * the width are dropped on packing.
+     */
+namespace bitpack
 {
-    /* 64-bit registers (ARM doubleword registers -- D0, D1, ...) */
-    /* 8 8-bit lanes */
-    using bool8x8_t = simd_type <std::int8_t, 8, boolean_tag>;
-    using int8x8_t  = simd_type <std::int8_t, 8>;
-    using uint8x8_t = simd_type <std::uint8_t, 8>;
+    /* Number of values in a packed block. */
+    constexpr std::size_t block_values = 1024;
 
-    /* 4 16-bit lanes */
-    using bool16x4_t = simd_type <std::int16_t, 4, boolean_tag>;
-    using int16x4_t  = simd_type <std::int16_t, 4>;
-    using uint16x4_t = simd_type <std::uint16_t, 4>;
+    /* Number of lanes the block is transposed across. */
+    constexpr std::size_t block_lanes = 32;
 
-    /* 2 32-bit lanes */
-    using bool32x2_t  = simd_type <std::int32_t, 2, boolean_tag>;
-    using int32x2_t   = simd_type <std::int32_t, 2>;
-    using uint32x2_t  = simd_type <std::uint32_t, 2>;
-    using float32x2_t = simd_type <float, 2>;
+    /* Number of 32 bit words in a packed block of the given bit width. */
+    constexpr std::size_t packed_words (std::size_t width) noexcept
+    {
+        return block_lanes * width;
+    }
+
+    /*
+     * Packs the 1024 values at in into width bits each, writing
+     * packed_words (width) words at out.
+     */
+    template <std::size_t width>
+    void pack (std::uint32_t const * in, std::uint32_t * out) noexcept
+    {
+        static_assert (
+            width >= 1 && width <= 32,
+            "template parameter width must be in [1, 32]"
+        );
+
+        constexpr std::uint32_t mask =
+            width == 32 ? ~std::uint32_t {0}
+                        : (std::uint32_t {1} << (width % 32)) - 1;
+
+        std::uint32_t acc [block_lanes] = {};
+        std::size_t bits = 0;
+        std::size_t row = 0;
+
+        for (std::size_t t = 0; t < block_values / block_lanes; ++t) {
+            for (std::size_t j = 0; j < block_lanes; ++j) {
+                acc [j] |= (in [t * block_lanes + j] & mask) << bits;
+            }
+
+            bits += width;
+            if (bits >= 32) {
+                for (std::size_t j = 0; j < block_lanes; ++j) {
+                    out [row * block_lanes + j] = acc [j];
+                }
+
+                row += 1;
+                bits -= 32;
+                for (std::size_t j = 0; j < block_lanes; ++j) {
+                    acc [j] = bits
+                        ? (in [t * block_lanes + j] & mask) >> (width - bits)
+                        : 0;
+                }
+            }
+        }
+    }
+
+    /*
+     * Unpacks a block packed at the given width: reads packed_words
+     * (width) words at in and writes the 1024 recovered values at out.
+     */
+    template <std::size_t width>
+    void unpack (std::uint32_t const * in, std::uint32_t * out) noexcept
+    {
+        static_assert (
+            width >= 1 && width <= 32,
+            "template parameter width must be in [1, 32]"
+        );
+
+        constexpr std::uint32_t mask =
+            width == 32 ? ~std::uint32_t {0}
+                        : (std::uint32_t {1} << (width % 32)) - 1;
+
+        std::size_t bits = 0;
+        std::size_t row = 0;
+
+        for (std::size_t t = 0; t < block_values / block_lanes; ++t) {
+            if (bits + width <= 32) {
+                for (std::size_t j = 0; j < block_lanes; ++j) {
+                    out [t * block_lanes + j] =
+                        (in [row * block_lanes + j] >> bits) & mask;
+                }
+
+                bits += width;
+                if (bits == 32) {
+                    bits = 0;
+                    row += 1;
+                }
+            } else {
+                for (std::size_t j = 0; j < block_lanes; ++j) {
+                    auto const low =
+                        in [row * block_lanes + j] >> bits;
+                    auto const high =
+                        in [(row + 1) * block_lanes + j] << (32 - bits);
+                    out [t * block_lanes + j] = (low | high) & mask;
+                }
 
-    /* 1 64-bit lane */
-    using bool64x1_t = simd_type <std::int64_t, 1, boolean_tag>;
-    using int64x1_t  = simd_type <std::int64_t, 1>;
-    using uint64x1_t = simd_type <std::uint64_t, 1>;
+                bits = bits + width - 32;
+                row += 1;
+            }
+        }
+    }
 
-    /* 128-bit registers (ARM quadword registers -- Q0, Q1, ...) */
-    /* 16 8-bit lanes */
-    using bool8x16_t = simd_type <std::int8_t, 16, boolean_tag>;
-    using int8x16_t  = simd_type <std::int8_t, 16>;
-    using uint8x16_t = simd_type <std::uint8_t, 16>;
+    /*
+     * Lane-wise delta encoding over a block, the usual companion to the
+     * packer for sorted or slowly varying data: each value is replaced by
+     * its difference from the value 32 positions earlier (the previous
+     * value of the same lane), leaving the first 32 values as they are.
+     * The per-lane form keeps both directions free of cross-lane
+     * dependences -- decoding is 32 independent prefix sums advancing in
+     * lockstep -- so both vectorize exactly like the packing loops, where
+     * a flat sequential delta would serialize the decoder. Differences
+     * wrap modulo 2^32; encode and decode round-trip for any input.
+     */
+    inline void delta_encode (std::uint32_t const * in,
+                              std::uint32_t * out) noexcept
+    {
+        for (std::size_t t = block_values / block_lanes; t > 1; --t) {
+            for (std::size_t j = 0; j < block_lanes; ++j) {
+                auto const i = (t - 1) * block_lanes + j;
+                out [i] = in [i] - in [i - block_lanes];
+            }
+        }
 
-    /* 8 16-bit lanes */
-    using bool16x8_t = simd_type <std::int16_t, 8, boolean_tag>;
-    using int16x8_t  = simd_type <std::int16_t, 8>;
-    using uint16x8_t = simd_type <std::uint16_t, 8>;
+        for (std::size_t j = 0; j < block_lanes; ++j) {
+            out [j] = in [j];
+        }
+    }
 
-    /* 4 32-bit lanes */
-    using bool32x4_t          = simd_type <std::int32_t, 4, boolean_tag>;
-    using int32x4_t           = simd_type <std::int32_t, 4>;
-    using uint32x4_t          = simd_type <std::uint32_t, 4>;
-    using float32x4_t         = simd_type <float, 4>;
-    using complex_float32x4_t = simd_type <float, 4, complex_tag>;
+    /*
+     * Inverse of delta_encode; in and out may be the same block.
+     */
+    inline void delta_decode (std::uint32_t const * in,
+                              std::uint32_t * out) noexcept
+    {
+        for (std::size_t j = 0; j < block_lanes; ++j) {
+            out [j] = in [j];
+        }
 
-    /* 2 64-bit lane */
-    using bool64x2_t = simd_type <std::int64_t, 2, boolean_tag>;
-    using int64x2_t  = simd_type <std::int64_t, 2>;
-    using uint64x2_t = simd_type <std::uint64_t, 2>;
-}   // namespace neon
+        for (std::size_t t = 1; t < block_values / block_lanes; ++t) {
+            for (std::size_t j = 0; j < block_lanes; ++j) {
+                auto const i = t * block_lanes + j;
+                out [i] = in [i] + out [i - block_lanes];
+            }
+        }
+    }
+}   // namespace bitpack
 }   // namespace simd
 
 #undef cpp14_constexpr
@@ -10971,6 +13120,361 @@ namespace neon
 
 namespace simd
 {
+namespace detail
+{
+    /*
+     * Replicates the conversion std::basic_ostream::operator<< performs on
+     * signed integral operands when the basefield is oct or hex: the value
+     * is first converted to the corresponding unsigned type of the promoted
+     * operand and only then widened for std::num_put::put.
+     */
+    template <
+        typename PromotedType, typename OutType,
+        bool = std::is_integral <PromotedType>::value &&
+               std::is_signed <PromotedType>::value
+    >
+    struct ostream_basefield_cast
+    {
+        static unsigned long long apply (PromotedType val) noexcept
+        {
+            return static_cast <
+                typename std::make_unsigned <PromotedType>::type
+            > (val);
+        }
+    };
+
+    template <typename PromotedType, typename OutType>
+    struct ostream_basefield_cast <PromotedType, OutType, false>
+    {
+        static OutType apply (PromotedType val) noexcept
+        {
+            return static_cast <OutType> (val);
+        }
+    };
+
+    /*
+     * Inserter implementation for arithmetic lane values. Lane values are
+     * written straight into the stream buffer through the std::num_put
+     * facet of the stream locale, which is looked up exactly once for the
+     * whole vector. This avoids the temporary std::basic_ostringstream
+     * (one heap allocation plus a locale imbuement per call) that the
+     * generic implementation below requires, while the facet itself still
+     * honors the flags, locale, and precision of the output stream.
+     */
+    template <typename SIMDType, typename CharT, typename CharTraits>
+    void ostream_insert (std::basic_ostream <CharT, CharTraits> & os,
+                         SIMDType const & v,
+                         std::true_type)
+    {
+        using traits_type = simd_traits <SIMDType>;
+        using value_type  = typename traits_type::value_type;
+
+        /* integer promoted lane type, as produced by the unary + below */
+        using promoted_type = decltype (+value_type {});
+
+        static constexpr std::size_t lanes = traits_type::lanes;
+
+        /* select type to hand to std::num_put::put */
+        using out_type = typename std::conditional <
+            std::is_integral <promoted_type>::value,
+            /* integral values */
+            typename std::conditional <
+                std::is_signed <promoted_type>::value,
+                long long,
+                unsigned long long
+            >::type,
+            /* floating point values */
+            typename std::conditional <
+                std::is_same <promoted_type, long double>::value,
+                long double,
+                double
+            >::type
+        >::type;
+
+        using char_type    = typename CharTraits::char_type;
+        using osb_iterator = std::ostreambuf_iterator <CharT, CharTraits>;
+
+        /*
+         * A nonzero stream width applies to the assembled tuple as one
+         * field, which only the staging implementation below reproduces:
+         * std::num_put::put would pad the first lane number inside the
+         * parentheses and reset the width there.
+         */
+        if (os.width () != 0) {
+            return ostream_insert (os, v, std::false_type {});
+        }
+
+        auto const & locale = os.getloc ();
+        auto const & ctype  = std::use_facet <std::ctype <char_type>> (locale);
+        auto const & num_put =
+            std::use_facet <std::num_put <char_type, osb_iterator>> (locale);
+
+        auto const flags      = os.flags ();
+        bool const nondecimal = static_cast <bool> (
+            flags & (std::ios_base::oct | std::ios_base::hex)
+        );
+        auto const fill       = os.fill ();
+
+        using basefield_cast = ostream_basefield_cast <promoted_type, out_type>;
+
+        /*
+         * Lane values are staged on the stack up-front so the vector is
+         * extracted exactly once instead of being spilled and reloaded
+         * around each opaque std::num_put::put call below.
+         */
+        value_type lanes_buf [lanes];
+        for (std::size_t i = 0; i < lanes; ++i) {
+            lanes_buf [i] = v.value (i);
+        }
+
+        osb_iterator out {os};
+        *out++ = ctype.widen ('(');
+        for (std::size_t i = 0; i < lanes; ++i) {
+            if (nondecimal) {
+                out = num_put.put (out, os, fill,
+                                   basefield_cast::apply (+lanes_buf [i]));
+            } else {
+                out = num_put.put (out, os, fill,
+                                   static_cast <out_type> (lanes_buf [i]));
+            }
+            *out++ = ctype.widen (i < lanes - 1 ? ';' : ')');
+        }
+
+        if (out.failed ()) {
+            os.setstate (std::ios_base::badbit);
+        }
+    }
+
+    /*
+     * Inserter implementation for lane values without a std::num_put::put
+     * overload (complex lane values, and 128 bit lane values for which a
+     * user defined inserter must be available for lookup in the calling
+     * scope). The tuple is staged in a temporary stream carrying over the
+     * flags, locale, and precision of the output stream.
+     */
+    template <typename SIMDType, typename CharT, typename CharTraits>
+    void ostream_insert (std::basic_ostream <CharT, CharTraits> & os,
+                         SIMDType const & v,
+                         std::false_type)
+    {
+        static constexpr std::size_t lanes = simd_traits <SIMDType>::lanes;
+
+        std::basic_ostringstream <CharT, CharTraits> ss;
+        ss.flags (os.flags ());
+        ss.imbue (os.getloc ());
+        ss.precision (os.precision ());
+
+        ss << '(';
+        for (std::size_t i = 0; i < lanes - 1; ++i) {
+            ss << +v.value (i) << ';';
+        }
+        ss << +v.value (lanes - 1) << ')';
+        os << ss.str ();
+    }
+
+namespace util
+{
+    /*
+     * One-shot FNV-1a fold over a raw object representation, taken 64 bits
+     * at a time (with a zero padded tail for objects smaller than a word).
+     * This backs the std::hash specializations below: folding the vector
+     * storage directly replaces the per-lane std::hash call plus
+     * hash-combine chain of the generic implementation with one multiply
+     * per eight lane bytes.
+     */
+    inline std::size_t hash_words (void const * data, std::size_t size)
+        noexcept
+    {
+        auto const bytes = static_cast <unsigned char const *> (data);
+
+#if defined (SIMD_HEADER_CRC_HASH) && defined (__SSE4_2__)
+        /*
+         * Opt-in hardware fingerprint: defining SIMD_HEADER_CRC_HASH in a
+         * translation unit compiled with SSE4.2 support replaces the FNV
+         * fold with the crc32 instruction, which retires at one word per
+         * three cycles against the serial multiply chain below. The
+         * trade-off is state width -- the CRC accumulator carries 32 bits
+         * where FNV carries 64 -- so the default stays FNV and the final
+         * multiply here only spreads the CRC bits across the word.
+         */
+        std::uint64_t h = 14695981039346656037ULL;
+        std::uint64_t word;
+        std::size_t i = 0;
+
+        for (; size - i >= sizeof (word); i += sizeof (word)) {
+            std::memcpy (&word, bytes + i, sizeof word);
+            h = __builtin_ia32_crc32di (h, word);
+        }
+
+        if (i < size) {
+            word = 0;
+            std::memcpy (&word, bytes + i, size - i);
+            h = __builtin_ia32_crc32di (h, word);
+        }
+
+        return h * 0x9e3779b97f4a7c15ULL;
+#else
+        std::uint64_t h = 14695981039346656037ULL;
+        std::uint64_t word;
+        std::size_t i = 0;
+
+        for (; size - i >= sizeof (word); i += sizeof (word)) {
+            std::memcpy (&word, bytes + i, sizeof word);
+            h = (h ^ word) * 1099511628211ULL;
+        }
+
+        if (i < size) {
+            word = 0;
+            std::memcpy (&word, bytes + i, size - i);
+            h = (h ^ word) * 1099511628211ULL;
+        }
+
+        return h;
+#endif
+    }
+
+    /*
+     * Hash over the raw vector storage, for lane types whose object
+     * representation is unique per value: integral and boolean lanes
+     * (booleans are stored normalized to 0 and 1).
+     */
+    template <typename SIMDType>
+    inline std::size_t vector_hash_bytes (SIMDType const & sv,
+                                          std::false_type) noexcept
+    {
+        return hash_words (&sv.data (), sizeof (sv.data ()));
+    }
+
+    /*
+     * Hash over the raw vector storage for floating point lanes. Negative
+     * zero compares equal to positive zero and so must hash identically;
+     * adding positive zero to every lane collapses the former onto the
+     * latter and leaves every other value (including NaNs) bit-unchanged.
+     */
+    template <typename SIMDType>
+    inline std::size_t vector_hash_bytes (SIMDType const & sv,
+                                          std::true_type) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+
+        auto const normalized = sv + value_type {0};
+        return hash_words (&normalized.data (), sizeof (normalized.data ()));
+    }
+
+    template <typename SIMDType>
+    inline std::size_t vector_hash (SIMDType const & sv, std::true_type)
+        noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+
+        return vector_hash_bytes (
+            sv, std::is_floating_point <value_type> {}
+        );
+    }
+
+    /*
+     * Folds a vector of per-lane hash values into one value pairwise:
+     * lanes combine with their upper-half partners, halving the problem
+     * each round, so the chain of dependent hash_combine applications is
+     * logarithmic in the lane count where a left fold over the lanes
+     * serializes every combine behind the previous one. The combines in
+     * each round are independent and the lane count is a compile time
+     * power of two, so the rounds unroll flat.
+     */
+    template <typename HashSIMDType>
+    inline std::size_t hash_fold_tree (HashSIMDType const & h) noexcept
+    {
+        constexpr std::size_t lanes =
+            simd::simd_traits <HashSIMDType>::lanes;
+
+        std::size_t buffer [lanes];
+        for (std::size_t i = 0; i < lanes; ++i) {
+            buffer [i] = h.value (i);
+        }
+
+        for (std::size_t stride = lanes / 2; stride != 0; stride /= 2) {
+            for (std::size_t i = 0; i < stride; ++i) {
+                hash_combine <std::size_t> (
+                    buffer [i], buffer [i + stride]
+                );
+            }
+        }
+
+        return buffer [0];
+    }
+
+    /*
+     * Fallback retaining the per-lane hashing semantics, for lane types
+     * whose object representation carries padding bits (long double).
+     */
+    template <typename SIMDType>
+    inline std::size_t vector_hash (SIMDType const & sv, std::false_type)
+        noexcept
+    {
+        simd::hash <SIMDType> hasher {};
+        return hash_fold_tree (hasher (sv));
+    }
+
+    /*
+     * Single hash value over all lanes of a SIMD vector; dispatches to the
+     * raw-storage fold whenever the lane object representation admits it.
+     */
+    template <typename SIMDType>
+    inline std::size_t vector_hash (SIMDType const & sv) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using bytes_dispatch = std::integral_constant <
+            bool,
+            std::is_integral <value_type>::value ||
+                detail::iec559_value <value_type>::value
+        >;
+
+        return vector_hash (sv, bytes_dispatch {});
+    }
+
+#if defined (__SIZEOF_INT128__)
+    /*
+     * 128 bit integral lanes: std::hash has no 128 bit specialization to
+     * lean on, but the lane object representation is unique per value
+     * just like the narrower integral types, so the raw storage fold
+     * applies directly -- no detour through vectors of 64 bit halves.
+     * (is_integral rejects __int128 under strict conformance, which is
+     * why the generic byte dispatch cannot pick this up on its own.)
+     */
+    template <typename SIMDType>
+    inline std::size_t integral_vector_hash (SIMDType const & sv,
+                                             std::true_type) noexcept
+    {
+        return vector_hash_bytes (sv, std::false_type {});
+    }
+#endif
+
+    template <typename SIMDType>
+    inline std::size_t integral_vector_hash (SIMDType const & sv,
+                                             std::false_type) noexcept
+    {
+        return vector_hash (sv);
+    }
+
+    /*
+     * Hash entry point for integral and boolean lane vectors: 128 bit
+     * lanes take the halved fold above (std::is_integral does not admit
+     * the extended types under the C++11 language baseline, so the
+     * dispatch keys on the lane size), everything else the usual path.
+     */
+    template <typename SIMDType>
+    inline std::size_t integral_vector_hash (SIMDType const & sv) noexcept
+    {
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using wide_dispatch = std::integral_constant <
+            bool, sizeof (value_type) == 16
+        >;
+
+        return integral_vector_hash (sv, wide_dispatch {});
+    }
+}   // namespace util
+}   // namespace detail
+
     template <
         typename SIMDType, typename CharT, typename CharTraits,
         typename = typename std::enable_if <
@@ -10981,21 +13485,17 @@ namespace simd
         operator<< (std::basic_ostream <CharT, CharTraits> & os,
                     SIMDType const & v)
     {
-        static constexpr std::size_t lanes = simd_traits <SIMDType>::lanes;
+        using value_type = typename simd_traits <SIMDType>::value_type;
+        using facet_dispatch = std::integral_constant <
+            bool,
+            (std::is_integral <value_type>::value &&
+                sizeof (value_type) <= sizeof (long long)) ||
+            std::is_floating_point <value_type>::value
+        >;
 
         typename std::basic_ostream <CharT, CharTraits>::sentry sentry {os};
         if (sentry) {
-            std::basic_ostringstream <CharT, CharTraits> ss;
-            ss.flags (os.flags ());
-            ss.imbue (os.getloc ());
-            ss.precision (os.precision ());
-
-            ss << '(';
-            for (std::size_t i = 0; i < lanes - 1; ++i) {
-                ss << +v.value (i) << ';';
-            }
-            ss << +v.value (lanes - 1) << ')';
-            os << ss.str ();
+            detail::ostream_insert (os, v, facet_dispatch {});
         }
 
         return os;
@@ -11050,69 +13550,189 @@ namespace simd
 
         auto const flags    = is.flags ();
         auto const & locale = is.getloc ();
-        auto const & ctype  = std::use_facet <std::ctype <char_type>> (locale);
+        auto const * const ctype_ptr =
+            &std::use_facet <std::ctype <char_type>> (locale);
         auto const & num_get =
             std::use_facet <std::num_get <char_type>> (locale);
 
+        /*
+         * Skips ahead to the next character that can begin a numeral under
+         * the active basefield: a digit (decimal, or no basefield set), a
+         * digit below eight (octal) or a hexadecimal digit. The scan works
+         * on the stream buffer directly -- sgetc and sbumpc only read and
+         * advance the internal get-area pointers, paying a virtual call
+         * per buffer refill, where istream peek and ignore each construct
+         * a sentry and re-check stream state per character. A wider
+         * (word-at-a-time) classifier would need the get-area window
+         * itself, which std::streambuf keeps protected, and unread bytes
+         * could not be returned on non-seekable streams, so one character
+         * per step through the buffered interface is the portable floor;
+         * for narrow streams ctype <char>::is is a non-virtual table
+         * lookup and the loop runs without any per-character dispatch.
+         *
+         * For narrow character streams the classification is folded into
+         * a 256 byte table built once per call: each entry records
+         * whether that byte can begin a numeral under the active flags,
+         * so the scan loop is a single byte load per input character
+         * with no mask test and no octal exclusion compares. The table
+         * spans four cache lines and is indexed by unsigned char, which
+         * does not extend to wider character types; those keep the
+         * per-character classification.
+         */
         auto discard_non_numeric =
-        [&flags, &locale, &ctype] (stream_type & _is) -> stream_type &
-        {
-            if (flags & std::ios_base::dec) {
-                while (!_is.eof () && !_is.bad ()) {
-                    if (!ctype.is (std::ctype_base::digit,
-                                   static_cast <char_type> (_is.peek ())))
-                    {
-                        _is.ignore ();
-                        continue;
-                    } else {
-                        break;
-                    }
+        [flags, ctype_ptr] (stream_type & _is) -> stream_type &
+        {
+            auto * const buf    = _is.rdbuf ();
+            auto const & ctype  = *ctype_ptr;
+
+            bool const oct = static_cast <bool> (flags & std::ios_base::oct);
+            bool const hex = static_cast <bool> (flags & std::ios_base::hex);
+            auto const mask =
+                hex ? std::ctype_base::xdigit : std::ctype_base::digit;
+            auto const eight = ctype.widen ('8');
+            auto const nine  = ctype.widen ('9');
+
+            constexpr bool narrow_chars =
+                std::is_same <char_type, char>::value;
+            constexpr std::size_t table_size = std::size_t {
+                std::numeric_limits <unsigned char>::max ()
+            } + 1;
+
+            unsigned char keep [table_size] = {};
+            if (narrow_chars) {
+                for (std::size_t b = 0; b < table_size; ++b) {
+                    auto const c = char_traits::to_char_type (
+                        static_cast <typename char_traits::int_type> (b)
+                    );
+                    keep [b] = ctype.is (mask, c) &&
+                        !(oct && (char_traits::eq (c, eight) ||
+                                  char_traits::eq (c, nine)));
                 }
-            } else if (flags & std::ios_base::oct) {
-                auto const eight = ctype.widen ('8');
-                auto const nine  = ctype.widen ('9');
-
-                while (!_is.eof () && !_is.bad ()) {
-                    auto const peek = _is.peek ();
-                    if (!ctype.is (std::ctype_base::digit,
-                                   static_cast <char_type> (peek)) ||
-                        char_traits::eq (
-                            static_cast <char_type> (peek), eight) ||
-                        char_traits::eq (
-                            static_cast <char_type> (peek), nine))
-                    {
-                        _is.ignore ();
-                        continue;
-                    } else {
-                        break;
-                    }
+            }
+
+            while (true) {
+                auto const peek = buf->sgetc ();
+                if (char_traits::eq_int_type (peek, char_traits::eof ())) {
+                    break;
                 }
-            } else if (flags & std::ios_base::hex) {
-                while (!_is.eof () && !_is.bad ()) {
-                    if (!ctype.is (std::ctype_base::xdigit,
-                                   static_cast <char_type> (_is.peek ())))
-                    {
-                        _is.ignore ();
-                        continue;
-                    } else {
-                        break;
-                    }
+
+                auto const c = char_traits::to_char_type (peek);
+                bool numeric;
+                if (narrow_chars) {
+                    numeric = static_cast <bool> (
+                        keep [static_cast <unsigned char> (c)]
+                    );
+                } else {
+                    numeric = ctype.is (mask, c) &&
+                        !(oct && (char_traits::eq (c, eight) ||
+                                  char_traits::eq (c, nine)));
                 }
-            } else {
-                /* assume decimal if no flags are set */
-                while (!_is.eof () && !_is.bad ()) {
-                    if (!ctype.is (std::ctype_base::digit,
-                                   static_cast <char_type> (_is.peek ())))
-                    {
-                        _is.ignore ();
-                        continue;
+
+                if (numeric) {
+                    break;
+                }
+
+                buf->sbumpc ();
+            }
+
+            return _is;
+        };
+
+        /*
+         * Locale-free fast path for integer lane values parsed under the
+         * decimal basefield with the classic locale. In that configuration
+         * std::num_get reduces to consuming a plain digit run (signs never
+         * reach it -- discard_non_numeric above skips them, and "C" has no
+         * thousands grouping), so the facet's virtual dispatch and locale
+         * machinery can be bypassed with a direct digit accumulation.
+         * The parse lands in the lane type directly -- no detour
+         * through the widened in_type the facet requires -- with one
+         * range check against the lane maximum; overflowing runs clamp
+         * to that maximum and raise failbit, like the facet does for
+         * its own destination type.
+         *
+         * The digit loop reads through the stream buffer directly, the
+         * same way discard_non_numeric does -- per-lane parsing cannot
+         * be batched into a single block read, because unconsumed bytes
+         * after the last digit could not be returned to a non-seekable
+         * stream, but at one character per step sgetc and sbumpc are
+         * plain get-area accesses where istream peek and ignore each
+         * construct a sentry and re-check stream state.
+         */
+        bool const use_decimal_fast_path =
+            std::is_integral <in_type>::value &&
+            !std::is_same <value_type, bool>::value &&
+            static_cast <bool> (flags & std::ios_base::dec) &&
+            locale == std::locale::classic ();
+
+        auto parse_decimal_digits =
+        [ctype_ptr] (stream_type & _is,
+                     typename std::ios_base::iostate & err,
+                     value_type & out) -> void
+        {
+            /* the lambda is only invoked for integral lane types; guard
+             * the limit conversion so other instantiations stay
+             * well-formed */
+            constexpr auto out_max = std::is_integral <value_type>::value
+                ? static_cast <unsigned long long> (
+                      std::numeric_limits <value_type>::max ()
+                  )
+                : 0ull;
+            constexpr auto acc_max =
+                std::numeric_limits <unsigned long long>::max ();
+
+            /*
+             * Any run of up to 19 decimal digits fits an unsigned long
+             * long accumulator without overflow, so the range check is
+             * deferred until after the loop for short runs -- typical
+             * inputs accumulate with one multiply-add per digit and no
+             * per-digit compare. Only runs past 19 digits fall back to
+             * checked accumulation against the accumulator's own limit.
+             */
+            constexpr std::size_t safe_digits = 19;
+
+            auto * const buf    = _is.rdbuf ();
+            auto const & ctype  = *ctype_ptr;
+
+            unsigned long long acc = 0;
+            std::size_t digits = 0;
+            bool overflow = false;
+
+            while (true) {
+                auto const peek = buf->sgetc ();
+                if (char_traits::eq_int_type (peek, char_traits::eof ())) {
+                    break;
+                }
+
+                auto const narrowed = ctype.narrow (
+                    char_traits::to_char_type (peek), '\0'
+                );
+                if (narrowed < '0' || narrowed > '9') {
+                    break;
+                }
+
+                buf->sbumpc ();
+
+                auto const digit =
+                    static_cast <unsigned long long> (narrowed - '0');
+                if (digits < safe_digits) {
+                    acc = acc * 10 + digit;
+                } else if (!overflow) {
+                    if (simd_unlikely (acc > (acc_max - digit) / 10)) {
+                        overflow = true;
                     } else {
-                        break;
+                        acc = acc * 10 + digit;
                     }
                 }
+                digits += 1;
             }
 
-            return _is;
+            if (simd_unlikely (digits == 0 || overflow || acc > out_max)) {
+                err |= std::ios_base::failbit;
+                out = std::numeric_limits <value_type>::max ();
+            } else {
+                out = static_cast <value_type> (acc);
+            }
         };
 
         typename std::ios_base::iostate err_state = std::ios_base::goodbit;
@@ -11123,20 +13743,49 @@ namespace simd
             if (sentry) {
                 isb_iterator end;
                 in_type in_val;
+                value_type fast_val {};
                 std::size_t count = 0;
 
+                /*
+                 * Lanes are assembled in an aligned scratch array and
+                 * committed with one aligned vector load after the
+                 * loop; per-lane set calls lower to an insert per lane
+                 * on wide vectors, which the compiler cannot fuse
+                 * across the intervening stream reads. On a failed
+                 * parse the destination vector is left untouched.
+                 */
+                alignas (SIMDType::alignment)
+                    value_type scratch [traits_type::lanes];
+
                 do {
                     discard_non_numeric (is);
-                    num_get.get (is, end, is, err_state, in_val);
+                    if (use_decimal_fast_path) {
+                        parse_decimal_digits (is, err_state, fast_val);
+                    } else {
+                        /*
+                         * The begin iterator is deliberately rebuilt
+                         * per call (a copy of the rdbuf pointer):
+                         * istreambuf_iterator may cache its current
+                         * character, and discard_non_numeric advances
+                         * the stream buffer underneath it between
+                         * facet calls, so a hoisted iterator could
+                         * dereference to a stale character.
+                         */
+                        num_get.get (is, end, is, err_state, in_val);
+                    }
 
-                    if (std::ios_base::failbit & err_state) {
+                    if (simd_unlikely (std::ios_base::failbit & err_state)) {
                         is.setstate (std::ios_base::failbit);
                         return is;
                     } else {
-                        v.set (count, static_cast <value_type> (in_val));
+                        scratch [count] = use_decimal_fast_path
+                            ? fast_val
+                            : static_cast <value_type> (in_val);
                         count += 1;
                     }
                 } while (count < traits_type::lanes);
+
+                v = SIMDType::load_aligned (scratch);
             }
         } catch (std::ios_base::failure &) {
             is.setstate (std::ios_base::failbit);
@@ -11151,161 +13800,50 @@ namespace std
     /*
      * Computes a single hash value for an object of a SIMD vector type.
      */
-#define std_hash_impl(ty, lanes, tag) template <>\
-    struct hash <simd::simd_type <ty, lanes, tag>>\
-    {\
-        using argument_type = simd::simd_type <ty, lanes, tag>;\
-        using result_type   = std::size_t;\
-\
-        result_type operator() (argument_type const & s) const noexcept\
-        {\
-            using value_type = typename simd::simd_traits <\
-                argument_type\
-            >::value_type;\
-\
-            simd::hash <argument_type> hasher {};\
-            return simd::math::accumulate (\
-                hasher (s), std::size_t {0},\
-                [] (std::size_t const & seed, value_type const & t) {\
-                    return simd::detail::util::hash_combine <value_type> (\
-                            seed, t\
-                    );\
-                }\
-            );\
-        }\
+    /*
+     * One partial specialization per underlying vector class template
+     * covers every lane type, lane count and category the header
+     * instantiates, replacing the former per-combination macro table
+     * (around 175 explicit specializations compiled into every consumer
+     * of this header). Partial specializations of std::hash for program
+     * defined types are permitted, and simd_type is an alias template,
+     * so the specializations name the class templates behind it.
+     */
+    template <typename T, std::size_t lanes>
+    struct hash <simd::detail::integral_simd_type <T, lanes>>
+    {
+        using argument_type = simd::detail::integral_simd_type <T, lanes>;
+        using result_type   = std::size_t;
+
+        result_type operator() (argument_type const & s) const noexcept
+        {
+            return simd::detail::util::integral_vector_hash (s);
+        }
     };
 
-#define std_hash_impl_lanes(ty)\
-    std_hash_impl(ty, 1, simd::boolean_tag)\
-    std_hash_impl(ty, 2, simd::boolean_tag)\
-    std_hash_impl(ty, 4, simd::boolean_tag)\
-    std_hash_impl(ty, 8, simd::boolean_tag)\
-    std_hash_impl(ty, 16, simd::boolean_tag)\
-    std_hash_impl(ty, 32, simd::boolean_tag)\
-    std_hash_impl(ty, 64, simd::boolean_tag)\
-    std_hash_impl(ty, 1, simd::arithmetic_tag)\
-    std_hash_impl(ty, 2, simd::arithmetic_tag)\
-    std_hash_impl(ty, 4, simd::arithmetic_tag)\
-    std_hash_impl(ty, 8, simd::arithmetic_tag)\
-    std_hash_impl(ty, 16, simd::arithmetic_tag)\
-    std_hash_impl(ty, 32, simd::arithmetic_tag)\
-    std_hash_impl(ty, 64, simd::arithmetic_tag)\
-    std_hash_impl(unsigned ty, 1, simd::arithmetic_tag)\
-    std_hash_impl(unsigned ty, 2, simd::arithmetic_tag)\
-    std_hash_impl(unsigned ty, 4, simd::arithmetic_tag)\
-    std_hash_impl(unsigned ty, 8, simd::arithmetic_tag)\
-    std_hash_impl(unsigned ty, 16, simd::arithmetic_tag)\
-    std_hash_impl(unsigned ty, 32, simd::arithmetic_tag)\
-    std_hash_impl(unsigned ty, 64, simd::arithmetic_tag)
-
-    std_hash_impl_lanes(char)
-    std_hash_impl_lanes(short)
-    std_hash_impl_lanes(int)
-    std_hash_impl_lanes(long)
-    std_hash_impl_lanes(long long)
-
-#undef std_hash_impl_lanes
-
-#define std_hash_impl_float_lanes(ty)\
-    std_hash_impl(ty, 1, simd::arithmetic_tag)\
-    std_hash_impl(ty, 2, simd::arithmetic_tag)\
-    std_hash_impl(ty, 4, simd::arithmetic_tag)\
-    std_hash_impl(ty, 8, simd::arithmetic_tag)\
-    std_hash_impl(ty, 16, simd::arithmetic_tag)\
-    std_hash_impl(ty, 32, simd::arithmetic_tag)\
-    std_hash_impl(ty, 64, simd::arithmetic_tag)
-
-    std_hash_impl_float_lanes(float)
-    std_hash_impl_float_lanes(double)
-    std_hash_impl_float_lanes(long double)
-
-#undef std_hash_impl_float_lanes
-#undef std_hash_impl
-
-#define std_hash_impl_int128(ty, lanes, tag) template <>\
-    struct hash <simd::simd_type <ty, lanes, tag>>\
-    {\
-        using argument_type = simd::simd_type <ty, lanes, tag>;\
-        using result_type   = std::size_t;\
-\
-        result_type operator() (argument_type const & s) const noexcept\
-        {\
-            struct alias {\
-                simd::simd_type <std::uint64_t, lanes, simd::arithmetic_tag>\
-                    v1;\
-                simd::simd_type <std::uint64_t, lanes, simd::arithmetic_tag>\
-                    v2;\
-            };\
-\
-            auto const & a = reinterpret_cast <alias const &> (s);\
-            simd::hash <decltype (a.v1)> hasher {};\
-            auto const h1 = hasher (a.v1);\
-            auto const h2 = hasher (a.v2);\
-\
-            using hash_type = decltype (h1);\
-            using hash_value_type =\
-                typename simd::simd_traits <hash_type>::value_type;\
-            return simd::math::accumulate (\
-                h1 ^ ((h2  + hash_type {hash_value_type {0x9e3779b9}}) +\
-                      (h1 << hash_type {hash_value_type {6}}) +\
-                      (h1 >> hash_type {hash_value_type {2}})),\
-                std::size_t {0},\
-                [] (std::size_t const & seed, std::uint64_t const & t) {\
-                    return simd::detail::util::hash_combine <std::uint64_t> (\
-                            seed, t\
-                    );\
-                }\
-            );\
-        }\
+    template <typename T, std::size_t lanes>
+    struct hash <simd::detail::boolean_simd_type <T, lanes>>
+    {
+        using argument_type = simd::detail::boolean_simd_type <T, lanes>;
+        using result_type   = std::size_t;
+
+        result_type operator() (argument_type const & s) const noexcept
+        {
+            return simd::detail::util::integral_vector_hash (s);
+        }
     };
 
-#if SIMD_HEADER_CLANG
-    std_hash_impl_int128(__int128_t, 1, simd::boolean_tag)
-    std_hash_impl_int128(__int128_t, 2, simd::boolean_tag)
-    std_hash_impl_int128(__int128_t, 4, simd::boolean_tag)
-    std_hash_impl_int128(__int128_t, 8, simd::boolean_tag)
-    std_hash_impl_int128(__int128_t, 16, simd::boolean_tag)
-    std_hash_impl_int128(__int128_t, 32, simd::boolean_tag)
-    std_hash_impl_int128(__int128_t, 64, simd::boolean_tag)
-    std_hash_impl_int128(__int128_t, 1, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128_t, 2, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128_t, 4, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128_t, 8, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128_t, 16, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128_t, 32, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128_t, 64, simd::arithmetic_tag)
-    std_hash_impl_int128(__uint128_t, 1, simd::arithmetic_tag)
-    std_hash_impl_int128(__uint128_t, 2, simd::arithmetic_tag)
-    std_hash_impl_int128(__uint128_t, 4, simd::arithmetic_tag)
-    std_hash_impl_int128(__uint128_t, 8, simd::arithmetic_tag)
-    std_hash_impl_int128(__uint128_t, 16, simd::arithmetic_tag)
-    std_hash_impl_int128(__uint128_t, 32, simd::arithmetic_tag)
-    std_hash_impl_int128(__uint128_t, 64, simd::arithmetic_tag)
-#elif SIMD_HEADER_GNUG
-    std_hash_impl_int128(__int128, 1, simd::boolean_tag)
-    std_hash_impl_int128(__int128, 2, simd::boolean_tag)
-    std_hash_impl_int128(__int128, 4, simd::boolean_tag)
-    std_hash_impl_int128(__int128, 8, simd::boolean_tag)
-    std_hash_impl_int128(__int128, 16, simd::boolean_tag)
-    std_hash_impl_int128(__int128, 32, simd::boolean_tag)
-    std_hash_impl_int128(__int128, 64, simd::boolean_tag)
-    std_hash_impl_int128(__int128, 1, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128, 2, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128, 4, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128, 8, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128, 16, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128, 32, simd::arithmetic_tag)
-    std_hash_impl_int128(__int128, 64, simd::arithmetic_tag)
-    std_hash_impl_int128(unsigned __int128, 1, simd::arithmetic_tag)
-    std_hash_impl_int128(unsigned __int128, 2, simd::arithmetic_tag)
-    std_hash_impl_int128(unsigned __int128, 4, simd::arithmetic_tag)
-    std_hash_impl_int128(unsigned __int128, 8, simd::arithmetic_tag)
-    std_hash_impl_int128(unsigned __int128, 16, simd::arithmetic_tag)
-    std_hash_impl_int128(unsigned __int128, 32, simd::arithmetic_tag)
-    std_hash_impl_int128(unsigned __int128, 64, simd::arithmetic_tag)
-#endif
+    template <typename T, std::size_t lanes>
+    struct hash <simd::detail::fp_simd_type <T, lanes>>
+    {
+        using argument_type = simd::detail::fp_simd_type <T, lanes>;
+        using result_type   = std::size_t;
 
-#undef std_hash_impl_int128
+        result_type operator() (argument_type const & s) const noexcept
+        {
+            return simd::detail::util::vector_hash (s);
+        }
+    };
 }   // namespace std
 
 #undef SIMD_HEADER_CLANG